@@ -0,0 +1,43 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cpfloat/branch/smear.hh>
+
+namespace MPG {
+using namespace CPFloat;
+using namespace CPFloat::Branch;
+void smear(Gecode::Home home, const CPFloatVarArgs& x, const ConstraintArgs& c,
+           const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+           BoundType ratio, int k) {
+  if ((vars.a != CPFLOAT_VAR_SMEAR_SUM) && (vars.a != CPFLOAT_VAR_SMEAR_MAX) &&
+      (vars.a != CPFLOAT_VAR_SMEAR_REL))
+    throw UnknownBranching("CPFloat::smear");
+  if (k < 2)
+    throw OutOfLimits("CPFloat::smear");
+  if (home.failed()) return;
+  Gecode::ViewArray<CPFloatView> y(home,x);
+  Constraint** cc = static_cast<Gecode::Space&>(home).alloc<Constraint*>(c.size());
+  for (int j=0; j<c.size(); j++)
+    cc[j] = &c[j]->clone();
+  Smear::post(home,y,c.size(),cc,vars,vals,ratio,k);
+}
+}
@@ -0,0 +1,173 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_BRANCH_SMEAR_HH__
+#define __CPFLOAT_BRANCH_SMEAR_HH__
+
+#include <cpfloat/cpfloat.hh>
+#include <cpfloat/expression.hh>
+#include <cpfloat/branch/viewval.hh>
+
+namespace MPG { namespace CPFloat { namespace Branch {
+
+/**
+ * \brief Brancher selecting variables by their smear
+ *
+ * The smear of \f$ x_i \f$ in the constraint \f$ f_k \f$ is
+ * \f$ |\partial f_k / \partial x_i| \cdot w(x_i) \f$, where the partial
+ * derivative is evaluated over the current box. It estimates how much
+ * of the width of \f$ f_k \f$ comes from \f$ x_i \f$. The smears of a
+ * variable are combined by CPFLOAT_VAR_SMEAR_SUM (sum),
+ * CPFLOAT_VAR_SMEAR_MAX (maximum) or CPFLOAT_VAR_SMEAR_REL (sum of the
+ * smears normalized by the total smear of each constraint).
+ *
+ * Value selection, commit and archiving are those of ViewValBrancher.
+ * The slices are tried by increasing violation: the constraints are
+ * evaluated with the slice in place of the domain of the variable, and
+ * the violation of a slice is the sum over the constraints of the
+ * distance from zero to the enclosure of left minus right. Slices with
+ * the same violation keep the order of the value selection.
+ */
+class Smear : public ViewValBrancher<CPFloatView> {
+protected:
+  /// Number of constraints
+  int m_;
+  /// Constraints to derive
+  Constraint** c_;
+  /// Order the slices by increasing violation
+  virtual void order(Gecode::Space& home, int p, int n, const BoundType* v,
+                     int* o) {
+    ViewValBrancher<CPFloatView>::order(home,p,n,v,o);
+    Gecode::Region r(home);
+    double* f = r.alloc<double>(n);
+    for (int s=0; s<n; s++) {
+      INTERVAL xi;
+      xi.lo = (s == 0) ? x_[p].glb() : v[s-1];
+      xi.hi = (s == n-1) ? x_[p].lub() : v[s];
+      f[s] = 0.0;
+      for (int k=0; k<m_; k++) {
+        c_[k]->substitute(x_[p],&xi);
+        c_[k]->evaluate();
+        INTERVAL d = c_[k]->residual();
+        c_[k]->substitute(x_[p],NULL);
+        if (d.lo > 0.0)
+          f[s] += d.lo;
+        else if (d.hi < 0.0)
+          f[s] -= d.hi;
+      }
+    }
+    // insertion sort is stable, ties keep the order of the value selection
+    for (int i=1; i<n; i++) {
+      int t = o[i];
+      int j = i;
+      for (; (j > 0) && (f[o[j-1]] > f[t]); j--)
+        o[j] = o[j-1];
+      o[j] = t;
+    }
+  }
+public:
+  /// Constructor for a brancher on the views \a x and constraints \a c
+  Smear(Gecode::Home home, Gecode::ViewArray<CPFloatView>& x,
+        int m, Constraint** c,
+        const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+        BoundType ratio, int k)
+    : ViewValBrancher<CPFloatView>(home,x,vars,vals,ratio,k), m_(m), c_(c) {
+    home.notice(*this,Gecode::AP_DISPOSE);
+  }
+  /// Brancher posting
+  static void post(Gecode::Home home, Gecode::ViewArray<CPFloatView>& x,
+                   int m, Constraint** c,
+                   const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+                   BoundType ratio, int k) {
+    (void) new (home) Smear(home,x,m,c,vars,vals,ratio,k);
+  }
+  /// Constructor for clonning
+  Smear(Gecode::Space& home, bool share, Smear& b)
+    : ViewValBrancher<CPFloatView>(home,share,b), m_(b.m_) {
+    c_ = home.alloc<Constraint*>(m_);
+    for (int k=0; k<m_; k++) {
+      c_[k] = &b.c_[k]->cloneToUpdate();
+      c_[k]->update(home,share,*b.c_[k]);
+    }
+  }
+  /// Brancher copying
+  virtual Gecode::Brancher* copy(Gecode::Space& home, bool share) {
+    return new (home) Smear(home,share,*this);
+  }
+  /// Brancher disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    home.ignore(*this,Gecode::AP_DISPOSE);
+    for (int k=0; k<m_; k++)
+      delete c_[k];
+    (void) ViewValBrancher<CPFloatView>::dispose(home);
+    return sizeof(*this);
+  }
+  /// Creates a choice for the unassigned view with the largest smear
+  virtual Gecode::Choice* choice(Gecode::Space& home) {
+    int n = x_.size();
+    Gecode::Region r(home);
+    double* s = r.alloc<double>(n);
+    double* t = r.alloc<double>(n);
+    for (int i=0; i<n; i++)
+      s[i] = 0.0;
+    for (int k=0; k<m_; k++) {
+      c_[k]->evaluate();
+      double total = 0.0;
+      for (int i=start_; i<n; i++) {
+        t[i] = 0.0;
+        if (x_[i].assigned())
+          continue;
+        INTERVAL d = c_[k]->derivative(x_[i]);
+        t[i] = std::max(std::fabs(d.lo),std::fabs(d.hi)) *
+          (x_[i].lub()-x_[i].glb());
+        total += t[i];
+      }
+      for (int i=start_; i<n; i++)
+        switch (vars_[0]) {
+        case CPFLOAT_VAR_SMEAR_MAX:
+          s[i] = std::max(s[i],t[i]);
+          break;
+        case CPFLOAT_VAR_SMEAR_REL:
+          if (total > 0.0)
+            s[i] += t[i] / total;
+          break;
+        default:
+          s[i] += t[i];
+        }
+    }
+    int p = -1;
+    double m0 = 0.0, m1 = 0.0;
+    for (int i=start_; i<n; i++) {
+      if (x_[i].assigned())
+        continue;
+      double b = merit(vars_[1],x_[i]);
+      if (p < 0 || s[i] > m0 || (s[i] == m0 && b > m1)) {
+        p = i; m0 = s[i]; m1 = b;
+      }
+    }
+    last_ = p;
+    return slice(home,p);
+  }
+};
+
+}}}
+#endif
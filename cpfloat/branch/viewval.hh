@@ -0,0 +1,353 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_BRANCH_VIEWVAL_HH__
+#define __CPFLOAT_BRANCH_VIEWVAL_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat { namespace Branch {
+
+/// Write the bits of \a v to \a e
+inline void archive_bound(Gecode::Archive& e, BoundType v) {
+  boost::uint64_t b;
+  std::memcpy(&b,&v,sizeof(b));
+  e << static_cast<unsigned int>(b >> 32)
+    << static_cast<unsigned int>(b & 0xffffffffU);
+}
+/// Read a bound written by archive_bound from \a e
+inline BoundType unarchive_bound(Gecode::Archive& e) {
+  unsigned int hi, lo;
+  e >> hi >> lo;
+  boost::uint64_t b = (static_cast<boost::uint64_t>(hi) << 32) | lo;
+  BoundType v;
+  std::memcpy(&v,&b,sizeof(v));
+  return v;
+}
+
+/**
+ * \brief Merit of branching on \a x for the selection \a vb
+ *
+ * Larger is better, selections that minimize return the negated value.
+ * CPFLOAT_VAR_NONE and CPFLOAT_VAR_ROUND_ROBIN do not rank the views.
+ */
+template <class View>
+double merit(CPFloatVarBranch vb, const View& x) {
+  switch (vb) {
+  case CPFLOAT_VAR_SIZE_MIN:
+    return -(x.lub()-x.glb());
+  case CPFLOAT_VAR_SIZE_MAX:
+    return x.lub()-x.glb();
+  case CPFLOAT_VAR_REL_SIZE_MAX:
+    return (x.lub()-x.glb()) /
+      std::max(1.0,std::max(std::fabs(x.glb()),std::fabs(x.lub())));
+  case CPFLOAT_VAR_DEGREE_MAX:
+    return x.degree();
+  default:
+    return 0.0;
+  }
+}
+
+/// Whether the value selection \a vb tries the lower half first
+inline bool lower_first(CPFloatValBranch vb) {
+  return (vb == CPFLOAT_VAL_SPLIT_MIN) || (vb == CPFLOAT_VAL_GEOM_MIN) ||
+    (vb == CPFLOAT_VAL_EXP_MIN);
+}
+
+/**
+ * \brief Split value of \a x for the value selection \a vb
+ *
+ * Median bisection of \f$ [0,10^8] \f$ needs more than twenty levels to
+ * reach unit magnitude, a geometric split halves the exponent range at
+ * every level. A domain is wide when its largest magnitude exceeds
+ * \a ratio times \f$ \max(1, smallest magnitude) \f$, narrow domains
+ * (or any split not strictly inside the domain) fall back to the median.
+ */
+template <class View>
+BoundType split(CPFloatValBranch vb, const View& x, BoundType ratio) {
+  BoundType l = x.glb();
+  BoundType u = x.lub();
+  if ((vb == CPFLOAT_VAL_SPLIT_MIN) || (vb == CPFLOAT_VAL_SPLIT_MAX))
+    return x.median();
+  BoundType a = std::max(std::min(std::fabs(l),std::fabs(u)),1.0);
+  BoundType b = std::max(std::fabs(l),std::fabs(u));
+  if (!(b > ratio*a))
+    return x.median();
+  if ((l < 0.0) && (0.0 < u))
+    return 0.0;
+  BoundType g;
+  if ((vb == CPFLOAT_VAL_GEOM_MIN) || (vb == CPFLOAT_VAL_GEOM_MAX)) {
+    g = std::sqrt(a)*std::sqrt(b);
+  } else {
+    int ea, eb;
+    (void) std::frexp(a,&ea);
+    (void) std::frexp(b,&eb);
+    g = std::ldexp(1.0,(ea+eb)/2);
+  }
+  if (!((a < g) && (g < b)))
+    return x.median();
+  return (u > 0.0) ? g : -g;
+}
+
+/**
+ * \brief Cut points splitting \a x into at most \a k slices
+ *
+ * Writes the cuts in increasing order to \a v (room for \a k-1 values)
+ * and returns the number of slices. Two slices are cut at split(), more
+ * are equal slices for the median selections and narrow domains, and
+ * slices of equal magnitude ratio otherwise (rounded to powers of two
+ * for the exponent selections). A wide domain straddling zero is cut
+ * at zero and its larger side is sliced geometrically from 1. Cuts that
+ * are not strictly increasing inside the domain are dropped, so a
+ * domain with few floats gets fewer slices.
+ */
+template <class View>
+int slices(CPFloatValBranch vb, const View& x, BoundType ratio, int k,
+           BoundType* v) {
+  BoundType l = x.glb();
+  BoundType u = x.lub();
+  if (k == 2) {
+    v[0] = split(vb,x,ratio);
+    return 2;
+  }
+  BoundType a = std::max(std::min(std::fabs(l),std::fabs(u)),1.0);
+  BoundType b = std::max(std::fabs(l),std::fabs(u));
+  bool equal = (vb == CPFLOAT_VAL_SPLIT_MIN) || (vb == CPFLOAT_VAL_SPLIT_MAX) ||
+    !(b > ratio*a);
+  if (equal) {
+    // weighted sum of l/k and u/k does not overflow on the widest domains
+    for (int i=1; i<k; i++)
+      v[i-1] = (l/k)*(k-i) + (u/k)*i;
+  } else {
+    bool straddle = (l < 0.0) && (0.0 < u);
+    // magnitudes of the cuts on the side of b, from a to b
+    int m = straddle ? k-1 : k;
+    if (straddle)
+      a = 1.0;
+    BoundType la = std::log(a);
+    BoundType lb = std::log(b);
+    int j = 0;
+    bool up = (u > 0.0) && (!straddle || (u >= -l));
+    if (straddle && up)
+      v[j++] = 0.0;
+    for (int i=1; i<m; i++) {
+      BoundType g = std::exp(la + (lb-la)*(up ? i : m-i)/m);
+      if ((vb == CPFLOAT_VAL_EXP_MIN) || (vb == CPFLOAT_VAL_EXP_MAX)) {
+        int e;
+        BoundType f = std::frexp(g,&e);
+        g = std::ldexp(1.0,(f < std::sqrt(0.5)) ? e-1 : e);
+      }
+      v[j++] = up ? g : -g;
+    }
+    if (straddle && !up)
+      v[j++] = 0.0;
+  }
+  int n = 0;
+  for (int i=0; i<k-1; i++)
+    if ((l < v[i]) && (v[i] < u) && ((n == 0) || (v[n-1] < v[i])))
+      v[n++] = v[i];
+  if (n == 0)
+    v[n++] = x.median();
+  return n+1;
+}
+
+/**
+ * \brief Brancher with configurable variable and value selection
+ *
+ * The variable is selected by a primary criterion, ties are broken by
+ * a secondary one and then by position. The selected variable is cut
+ * into up to \a k slices by slices(), one alternative per slice. The
+ * alternatives are tried in the order given by order(): from the lowest
+ * slice for CPFLOAT_VAL_*_MIN and from the highest one for
+ * CPFLOAT_VAL_*_MAX.
+ */
+template <class View>
+class ViewValBrancher : public Gecode::Brancher {
+protected:
+  /// Views to branch on
+  Gecode::ViewArray<View> x_;
+  /// All views before this position are assigned
+  mutable int start_;
+  /// Position of the last view branched on, for round robin
+  int last_;
+  /// Primary and secondary variable selection
+  CPFloatVarBranch vars_[2];
+  /// Value selection
+  CPFloatValBranch vals_;
+  /// Magnitude ratio above which a domain is wide, see split()
+  BoundType ratio_;
+  /// Maximal number of slices per choice
+  int k_;
+  /// Choice that slices the view at a position at increasing cuts
+  class PosVal : public Gecode::Choice {
+  public:
+    /// Position of the view
+    int pos_;
+    /// Cuts between the slices (alternatives()-1 values)
+    BoundType* val_;
+    /// Slice tried by each alternative
+    int* ord_;
+    /// Constructor for \a n slices
+    PosVal(const ViewValBrancher& b, int p, int n)
+      : Choice(b,n), pos_(p),
+        val_(Gecode::heap.alloc<BoundType>(n-1)),
+        ord_(Gecode::heap.alloc<int>(n)) {}
+    /// Destructor
+    ~PosVal(void) {
+      Gecode::heap.free<BoundType>(val_,alternatives()-1);
+      Gecode::heap.free<int>(ord_,alternatives());
+    }
+    /// Returns the size of the object
+    virtual size_t size(void) const {
+      return sizeof(*this) + (alternatives()-1)*sizeof(BoundType) +
+        alternatives()*sizeof(int);
+    }
+    /// Archive the position, the exact cuts and the order of the slices
+    virtual void archive(Gecode::Archive& e) const {
+      Choice::archive(e);
+      unsigned int n = alternatives();
+      e << pos_ << n;
+      for (unsigned int i=0; i<n-1; i++)
+        archive_bound(e,val_[i]);
+      for (unsigned int i=0; i<n; i++)
+        e << ord_[i];
+    }
+  };
+  /**
+   * \brief Order the \a n slices of the view at position \a p
+   *
+   * Stores in \a o the slice to try for each alternative, the cuts
+   * between the slices are \a v.
+   */
+  virtual void order(Gecode::Space&, int, int n, const BoundType*, int* o) {
+    bool lower = lower_first(vals_);
+    for (int i=0; i<n; i++)
+      o[i] = lower ? i : n-1-i;
+  }
+  /// Creates a choice slicing the view at position \a p
+  Gecode::Choice* slice(Gecode::Space& home, int p) {
+    PosVal* c;
+    {
+      Gecode::Region r(home);
+      BoundType* v = r.alloc<BoundType>(k_-1);
+      int n = slices(vals_,x_[p],ratio_,k_,v);
+      c = new PosVal(*this,p,n);
+      for (int i=0; i<n-1; i++)
+        c->val_[i] = v[i];
+    }
+    order(home,p,c->alternatives(),c->val_,c->ord_);
+    return c;
+  }
+public:
+  /// Constructor for a brancher on the views \a x
+  ViewValBrancher(Gecode::Home home, Gecode::ViewArray<View>& x,
+                  const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+                  BoundType ratio, int k)
+    : Brancher(home), x_(x), start_(0), last_(-1), vals_(vals), ratio_(ratio),
+      k_(k) {
+    vars_[0] = vars.a;
+    vars_[1] = vars.b;
+  }
+  /// Brancher posting
+  static void post(Gecode::Home home, Gecode::ViewArray<View>& x,
+                   const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+                   BoundType ratio, int k) {
+    (void) new (home) ViewValBrancher(home,x,vars,vals,ratio,k);
+  }
+  /// Constructor for clonning
+  ViewValBrancher(Gecode::Space& home, bool share, ViewValBrancher& b)
+    : Brancher(home,share,b), start_(b.start_), last_(b.last_),
+      vals_(b.vals_), ratio_(b.ratio_), k_(b.k_) {
+    vars_[0] = b.vars_[0];
+    vars_[1] = b.vars_[1];
+    x_.update(home,share,b.x_);
+  }
+  /// Brancher copying
+  virtual Gecode::Brancher* copy(Gecode::Space& home, bool share) {
+    return new (home) ViewValBrancher(home,share,*this);
+  }
+  /// Brancher disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    (void) Brancher::dispose(home);
+    return sizeof(*this);
+  }
+  /// Returns the status of the brancher
+  virtual bool status(const Gecode::Space&) const {
+    for (int i=start_; i<x_.size(); i++)
+      if (!x_[i].assigned()) {
+        start_ = i;
+        return true;
+      }
+    return false;
+  }
+  /// Creates a choice for the best unassigned view
+  virtual Gecode::Choice* choice(Gecode::Space& home) {
+    int n = x_.size();
+    // round robin starts after the last view branched on
+    int first = (vars_[0] == CPFLOAT_VAR_ROUND_ROBIN) ? last_+1 : start_;
+    int p = -1;
+    double m0 = 0.0, m1 = 0.0;
+    for (int k=0; k<n; k++) {
+      int i = (first+k) % n;
+      if (i < start_ || x_[i].assigned())
+        continue;
+      double a = merit(vars_[0],x_[i]);
+      double b = merit(vars_[1],x_[i]);
+      if (p < 0 || a > m0 || (a == m0 && b > m1)) {
+        p = i; m0 = a; m1 = b;
+      }
+    }
+    last_ = p;
+    return slice(home,p);
+  }
+  /// Creates a choice from the archive \a e
+  virtual Gecode::Choice* choice(const Gecode::Space&, Gecode::Archive& e) {
+    int pos;
+    unsigned int n;
+    e >> pos >> n;
+    PosVal* c = new PosVal(*this,pos,n);
+    for (unsigned int i=0; i<n-1; i++)
+      c->val_[i] = unarchive_bound(e);
+    for (unsigned int i=0; i<n; i++)
+      e >> c->ord_[i];
+    return c;
+  }
+  /// Commit choice
+  virtual Gecode::ExecStatus commit(Gecode::Space& home,
+                                    const Gecode::Choice& c, unsigned int a) {
+    const PosVal& pv = static_cast<const PosVal&>(c);
+    View x = x_[pv.pos_];
+    int s = pv.ord_[a];
+    int last = static_cast<int>(pv.alternatives())-1;
+    Gecode::ModEvent me;
+    if (s == 0)
+      me = x.leq(home,pv.val_[0]);
+    else if (s == last)
+      me = x.geq(home,pv.val_[last-1]);
+    else
+      me = x.narrow(home,pv.val_[s-1],pv.val_[s]);
+    return Gecode::me_failed(me) ? Gecode::ES_FAILED : Gecode::ES_OK;
+  }
+};
+
+}}}
+#endif
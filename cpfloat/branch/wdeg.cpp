@@ -0,0 +1,74 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cpfloat/branch/wdeg.hh>
+
+namespace MPG {
+using namespace CPFloat;
+using namespace CPFloat::Branch;
+void wdeg(Gecode::Home home, const CPFloatVarArgs& x, const ConstraintArgs& c,
+          const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+          double decay, BoundType ratio, int k) {
+  if ((vars.a != CPFLOAT_VAR_WDEG_MAX) && (vars.a != CPFLOAT_VAR_SIZE_WDEG_MAX))
+    throw UnknownBranching("CPFloat::wdeg");
+  if ((k < 2) || !((decay > 0.0) && (decay <= 1.0)))
+    throw OutOfLimits("CPFloat::wdeg");
+  if (home.failed()) return;
+  Gecode::Space& s = home;
+  Gecode::ViewArray<CPFloatView> y(home,x);
+  int m = c.size();
+  // positions in y of the views of every constraint
+  Gecode::Region r(s);
+  int* o = r.alloc<int>(m+1);
+  int** p = r.alloc<int*>(m);
+  o[0] = m+1;
+  for (int j=0; j<m; j++) {
+    Gecode::ViewArray<CPFloatView> v(s,c[j]->countViews());
+    c[j]->collectViews(v);
+    v.unique(s);
+    p[j] = r.alloc<int>(v.size());
+    int l = 0;
+    for (int i=0; i<y.size(); i++)
+      for (int h=0; h<v.size(); h++)
+        if (y[i] == v[h]) {
+          p[j][l++] = i;
+          break;
+        }
+    o[j+1] = o[j] + l;
+  }
+  Gecode::SharedArray<int> idx(o[m]);
+  for (int j=0; j<m; j++) {
+    idx[j] = o[j];
+    for (int l=0; l<o[j+1]-o[j]; l++)
+      idx[o[j]+l] = p[j][l];
+  }
+  idx[m] = o[m];
+  // the failures of these constraints advance their own clock
+  Weight::Clock t(0);
+  Weight* w = s.alloc<Weight>(m);
+  for (int j=0; j<m; j++) {
+    w[j] = c[j]->weight();
+    w[j].enable(t,decay);
+  }
+  WDeg::post(home,y,m,w,idx,vars,vals,ratio,k);
+}
+}
@@ -0,0 +1,131 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_BRANCH_WDEG_HH__
+#define __CPFLOAT_BRANCH_WDEG_HH__
+
+#include <cpfloat/cpfloat.hh>
+#include <cpfloat/expression.hh>
+#include <cpfloat/branch/viewval.hh>
+
+namespace MPG { namespace CPFloat { namespace Branch {
+
+/**
+ * \brief Brancher selecting variables by the failures of their constraints
+ *
+ * The weight of a view is the sum of the failure weights (see Weight)
+ * of the constraints it appears in that have at least two unassigned
+ * branching views. CPFLOAT_VAR_WDEG_MAX selects the view with the
+ * largest weight and CPFLOAT_VAR_SIZE_WDEG_MAX the one with the largest
+ * width times weight, so that the equations behind most failures are
+ * split first.
+ *
+ * Value selection, commit and archiving are those of ViewValBrancher.
+ */
+class WDeg : public ViewValBrancher<CPFloatView> {
+protected:
+  /// Number of constraints
+  int m_;
+  /// Failure weights of the constraints
+  Weight* w_;
+  /**
+   * \brief Branching views of the constraints
+   *
+   * The positions in x_ of the views of constraint \f$ k \f$ are the
+   * entries from idx_[k] to idx_[k+1] (excluded).
+   */
+  Gecode::SharedArray<int> idx_;
+public:
+  /// Constructor for a brancher on the views \a x and the weights \a w
+  WDeg(Gecode::Home home, Gecode::ViewArray<CPFloatView>& x,
+       int m, Weight* w, const Gecode::SharedArray<int>& idx,
+       const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+       BoundType ratio, int k)
+    : ViewValBrancher<CPFloatView>(home,x,vars,vals,ratio,k), m_(m), w_(w),
+      idx_(idx) {
+    home.notice(*this,Gecode::AP_DISPOSE);
+  }
+  /// Brancher posting
+  static void post(Gecode::Home home, Gecode::ViewArray<CPFloatView>& x,
+                   int m, Weight* w, const Gecode::SharedArray<int>& idx,
+                   const CPFloatVarTieBreak& vars, CPFloatValBranch vals,
+                   BoundType ratio, int k) {
+    (void) new (home) WDeg(home,x,m,w,idx,vars,vals,ratio,k);
+  }
+  /// Constructor for clonning
+  WDeg(Gecode::Space& home, bool share, WDeg& b)
+    : ViewValBrancher<CPFloatView>(home,share,b), m_(b.m_) {
+    w_ = home.alloc<Weight>(m_);
+    for (int k=0; k<m_; k++)
+      w_[k].update(home,share,b.w_[k]);
+    idx_.update(home,share,b.idx_);
+  }
+  /// Brancher copying
+  virtual Gecode::Brancher* copy(Gecode::Space& home, bool share) {
+    return new (home) WDeg(home,share,*this);
+  }
+  /// Brancher disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    home.ignore(*this,Gecode::AP_DISPOSE);
+    home.free<Weight>(w_,m_);
+    idx_.~SharedArray<int>();
+    (void) ViewValBrancher<CPFloatView>::dispose(home);
+    return sizeof(*this);
+  }
+  /// Creates a choice for the unassigned view with the largest weight
+  virtual Gecode::Choice* choice(Gecode::Space& home) {
+    int n = x_.size();
+    Gecode::Region r(home);
+    double* s = r.alloc<double>(n);
+    for (int i=0; i<n; i++)
+      s[i] = 0.0;
+    for (int k=0; k<m_; k++) {
+      int u = 0;
+      for (int j=idx_[k]; j<idx_[k+1]; j++)
+        if (!x_[idx_[j]].assigned())
+          u++;
+      if (u < 2)
+        continue;
+      double w = w_[k].weight();
+      for (int j=idx_[k]; j<idx_[k+1]; j++)
+        s[idx_[j]] += w;
+    }
+    int p = -1;
+    double m0 = 0.0, m1 = 0.0;
+    for (int i=start_; i<n; i++) {
+      if (x_[i].assigned())
+        continue;
+      double a = s[i];
+      if (vars_[0] == CPFLOAT_VAR_SIZE_WDEG_MAX)
+        a *= x_[i].lub()-x_[i].glb();
+      double b = merit(vars_[1],x_[i]);
+      if (p < 0 || a > m0 || (a == m0 && b > m1)) {
+        p = i; m0 = a; m1 = b;
+      }
+    }
+    last_ = p;
+    return slice(home,p);
+  }
+};
+
+}}}
+#endif
@@ -26,9 +26,14 @@
 #include <iostream>
 #include <sstream>
 #include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
 
 #include <gecode/kernel.hh>
 #include <boost/numeric/interval.hpp>
+#include <boost/cstdint.hpp>
 #include <smath/smath.h>
 
 
@@ -62,12 +67,30 @@ public:
     : Exception(l,"Attempt to create variable with empty domain") {}
 };
 
+class UnknownBranching : public Exception {
+public:
+  UnknownBranching(const char* l)
+    : Exception(l,"Unknown or unsupported branching") {}
+};
+
+class ArgumentSizeMismatch : public Exception {
+public:
+  ArgumentSizeMismatch(const char* l)
+    : Exception(l,"Sizes of argument arrays mismatch") {}
+};
+
+class SpillFailed : public Exception {
+public:
+  SpillFailed(const char* l)
+    : Exception(l,"Cannot write or read the spill file of a search") {}
+};
+
 }}
 
 // variable implementation
 namespace MPG { namespace CPFloat {
 
-/// Underlying type to represent an interval.
+/// Type used to compute with bounds (smath works on doubles).
 typedef double BoundType;
 /// Underlying type to represent an interval.
 typedef boost::numeric::interval<BoundType> Interval;
@@ -79,6 +102,287 @@ namespace Limits {
 const double max = (DBL_MAX / 2) -1;
 const double min = -max;
 }
+
+/**
+ * \brief Properties of the type \a B used to store the bounds of a
+ * variable.
+ *
+ * Propagation is always done on \ref BoundType, the views round the
+ * results outwards into \a B.
+ */
+template <class B>
+struct BoundTraits;
+
+template <>
+struct BoundTraits<double> {
+  /// Default precision of a single variable
+  static double precision(void) { return 0.0000000000001; }
+  /// Default precision of the variables of an array
+  static double array_precision(void) { return 0.000000001; }
+  /// Largest bound not greater than \a d
+  static double down(BoundType d) { return d; }
+  /// Smallest bound not less than \a d
+  static double up(BoundType d) { return d; }
+  /// Number of doubles in (\a l, \a u], for \a l <= \a u
+  static double ulps(double l, double u) {
+    // the difference reaches 2^64 when the bounds straddle zero
+    return static_cast<double>(static_cast<boost::uint64_t>(order(u)) -
+                               static_cast<boost::uint64_t>(order(l)));
+  }
+private:
+  /// Maps \a d to an integer that is monotone in \a d
+  static boost::int64_t order(double d) {
+    boost::int64_t i;
+    std::memcpy(&i,&d,sizeof(d));
+    return (i < 0) ? -(i ^ std::numeric_limits<boost::int64_t>::min()) : i;
+  }
+};
+
+template <>
+struct BoundTraits<float> {
+  /// Default precision of a single variable
+  static float precision(void) { return 0.00001f; }
+  /// Default precision of the variables of an array
+  static float array_precision(void) { return 0.00001f; }
+  /// Largest bound not greater than \a d
+  static float down(BoundType d) {
+    float f = static_cast<float>(d);
+    return (f > d) ? nextafterf(f,-HUGE_VALF) : f;
+  }
+  /// Smallest bound not less than \a d
+  static float up(BoundType d) {
+    float f = static_cast<float>(d);
+    return (f < d) ? nextafterf(f,HUGE_VALF) : f;
+  }
+  /// Number of floats in (\a l, \a u], for \a l <= \a u
+  static double ulps(float l, float u) {
+    return static_cast<double>(order(u)-order(l));
+  }
+private:
+  /// Maps \a f to an integer that is monotone in \a f
+  static boost::int64_t order(float f) {
+    boost::int32_t i;
+    std::memcpy(&i,&f,sizeof(f));
+    return (i < 0) ? -static_cast<boost::int64_t>(i ^ std::numeric_limits<boost::int32_t>::min()) : i;
+  }
+};
+
+/**
+ * \brief Precision stored in every variable.
+ *
+ * Each variable carries its own precision, which is copied on every
+ * clone. This is the default for all variable types.
+ */
+template <class B>
+class VarPrecision {
+protected:
+  B presicion_;
+public:
+  VarPrecision(B p=BoundTraits<B>::precision()) : presicion_(p) {}
+  /// Precision used by the variables of an array
+  static VarPrecision array_default(void) {
+    return VarPrecision(BoundTraits<B>::array_precision());
+  }
+  /// Whether the interval [\a l, \a u] is narrower than the precision
+  bool within(B l, B u) const {
+    return (u-l<presicion_);
+  }
+};
+
+/// Relation of a linear constraint to its right hand side
+enum CPFloatRelType {
+  CPFLOAT_RT_EQ, ///< Equality (\f$=\f$)
+  CPFLOAT_RT_LQ, ///< Less or equal (\f$\leq\f$)
+  CPFLOAT_RT_GQ  ///< Greater or equal (\f$\geq\f$)
+};
+
+/// Which variable to select for branching
+enum CPFloatVarBranch {
+  CPFLOAT_VAR_NONE,         ///< First unassigned
+  CPFLOAT_VAR_ROUND_ROBIN,  ///< Next unassigned after the last one branched on
+  CPFLOAT_VAR_SIZE_MIN,     ///< With smallest width
+  CPFLOAT_VAR_SIZE_MAX,     ///< With largest width
+  CPFLOAT_VAR_REL_SIZE_MAX, ///< With largest width relative to its magnitude
+  CPFLOAT_VAR_DEGREE_MAX,   ///< With most propagators
+  CPFLOAT_VAR_SMEAR_SUM,    ///< With largest sum of smears, see smear()
+  CPFLOAT_VAR_SMEAR_MAX,    ///< With largest smear, see smear()
+  CPFLOAT_VAR_SMEAR_REL,    ///< With largest sum of relative smears, see smear()
+  CPFLOAT_VAR_WDEG_MAX,     ///< With largest failure weight, see wdeg()
+  CPFLOAT_VAR_SIZE_WDEG_MAX ///< With largest width times failure weight, see wdeg()
+};
+
+/**
+ * \brief How to split the selected variable
+ *
+ * The geometric and exponent splits only apply to wide domains, whose
+ * largest magnitude exceeds a ratio times the smallest one (at least
+ * 1). A wide domain that straddles zero is split at zero, narrow
+ * domains are split at the median. Branchers cutting into more than
+ * two slices use equal or geometric slices the same way, see
+ * Branch::slices().
+ */
+enum CPFloatValBranch {
+  CPFLOAT_VAL_SPLIT_MIN, ///< At the median, lower half first
+  CPFLOAT_VAL_SPLIT_MAX, ///< At the median, upper half first
+  CPFLOAT_VAL_GEOM_MIN,  ///< At the geometric midpoint, lower half first
+  CPFLOAT_VAL_GEOM_MAX,  ///< At the geometric midpoint, upper half first
+  CPFLOAT_VAL_EXP_MIN,   ///< At the middle exponent band, lower half first
+  CPFLOAT_VAL_EXP_MAX    ///< At the middle exponent band, upper half first
+};
+
+/// Default magnitude ratio above which a domain is wide
+const double CPFLOAT_SPLIT_RATIO = 16.0;
+
+/// Variable selection \a a where ties are broken by \a b
+struct CPFloatVarTieBreak {
+  CPFloatVarBranch a;
+  CPFloatVarBranch b;
+};
+
+/// Break ties of the selection \a a by the selection \a b
+inline CPFloatVarTieBreak
+tiebreak(CPFloatVarBranch a, CPFloatVarBranch b) {
+  CPFloatVarTieBreak t;
+  t.a = a; t.b = b;
+  return t;
+}
+
+/// Criteria a precision can combine
+enum PrecisionMode {
+  PM_ABSOLUTE = 1, ///< Width below an absolute value
+  PM_RELATIVE = 2, ///< Width below a fraction of the magnitude
+  PM_ULP      = 4  ///< At most a number of representable values
+};
+
+/**
+ * \brief Assignment criterion of a precision class.
+ *
+ * An interval is narrow enough as soon as one of the criteria selected
+ * in \a mode holds. Relative and ULP criteria keep large magnitude
+ * variables from being split down to a few ULPs, and small magnitude
+ * ones from being assigned too early.
+ */
+template <class B>
+struct PrecisionSpec {
+  /// Combination of PrecisionMode values
+  int mode;
+  /// Absolute width
+  B abs;
+  /// Width relative to the largest magnitude of the bounds
+  B rel;
+  /// Number of representable values
+  double ulps;
+  /// Whether the interval [\a l, \a u] satisfies one of the criteria
+  bool within(B l, B u) const {
+    B w = u-l;
+    if ((mode & PM_ABSOLUTE) && w < abs)
+      return true;
+    if ((mode & PM_RELATIVE) && w <= rel*std::max(std::fabs(l),std::fabs(u)))
+      return true;
+    if ((mode & PM_ULP) && BoundTraits<B>::ulps(l,u) <= ulps)
+      return true;
+    return false;
+  }
+  /// Precision of absolute width \a a
+  static PrecisionSpec absolute(B a) {
+    PrecisionSpec s = {PM_ABSOLUTE, a, 0, 0};
+    return s;
+  }
+  /// Precision of relative width \a r
+  static PrecisionSpec relative(B r) {
+    PrecisionSpec s = {PM_RELATIVE, 0, r, 0};
+    return s;
+  }
+  /// Precision of \a n representable values
+  static PrecisionSpec ulp(double n) {
+    PrecisionSpec s = {PM_ULP, 0, 0, n};
+    return s;
+  }
+};
+
+/// Number of precision classes available for SharedPrecision
+#define CPFLOAT_PRECISION_CLASSES 4
+
+/**
+ * \brief Table of precision classes shared by all variables of type
+ * SharedPrecision.
+ *
+ * Giving each variable array its own class selects the assignment
+ * criterion per array.
+ *
+ * VarImp::assigned() has no access to its space, so the table is
+ * process wide. It should only be changed before spaces using it are
+ * created; it is read only during (parallel) search.
+ */
+template <class B>
+class PrecisionTable {
+private:
+  static PrecisionSpec<B> value_[CPFLOAT_PRECISION_CLASSES];
+public:
+  /// Returns the precision of class \a c
+  static const PrecisionSpec<B>& get(int c) {
+    return value_[c];
+  }
+  /// Sets the precision of class \a c to \a p
+  static void set(int c, const PrecisionSpec<B>& p) {
+    if (c < 0 || c >= CPFLOAT_PRECISION_CLASSES ||
+        (p.mode & (PM_ABSOLUTE | PM_RELATIVE | PM_ULP)) == 0 ||
+        ((p.mode & PM_ABSOLUTE) && !(p.abs > 0)) ||
+        ((p.mode & PM_RELATIVE) && !(p.rel > 0)) ||
+        ((p.mode & PM_ULP) && !(p.ulps >= 1)))
+      throw OutOfLimits("CPFloat::PrecisionTable::set");
+    value_[c] = p;
+  }
+  /// Sets the precision of class \a c to the absolute width \a p
+  static void set(int c, B p) {
+    set(c,PrecisionSpec<B>::absolute(p));
+  }
+};
+
+template <class B>
+PrecisionSpec<B> PrecisionTable<B>::value_[CPFLOAT_PRECISION_CLASSES] = {
+  PrecisionSpec<B>::absolute(BoundTraits<B>::array_precision()),
+  PrecisionSpec<B>::absolute(BoundTraits<B>::array_precision()),
+  PrecisionSpec<B>::absolute(BoundTraits<B>::array_precision()),
+  PrecisionSpec<B>::absolute(BoundTraits<B>::array_precision())
+};
+
+/**
+ * \brief Precision given by class \a C of the PrecisionTable.
+ *
+ * The variables store no precision at all, their footprint is reduced
+ * to the two bounds.
+ */
+template <int C>
+class SharedPrecision {
+public:
+  /// Precision used by the variables of an array
+  static SharedPrecision array_default(void) {
+    return SharedPrecision();
+  }
+  /// Whether the interval [\a l, \a u] is narrow enough for class \a C
+  template <class B>
+  bool within(B l, B u) const {
+    return PrecisionTable<B>::get(C).within(l,u);
+  }
+};
+
+/**
+ * \brief Expands \a M(B,P) for every bound and precision type the
+ * library is instantiated for.
+ */
+#define CPFLOAT_FOREACH_VAR_TYPE(M) \
+  M(double,VarPrecision<double>) \
+  M(float,VarPrecision<float>) \
+  M(double,SharedPrecision<0>) \
+  M(double,SharedPrecision<1>) \
+  M(double,SharedPrecision<2>) \
+  M(double,SharedPrecision<3>) \
+  M(float,SharedPrecision<0>) \
+  M(float,SharedPrecision<1>) \
+  M(float,SharedPrecision<2>) \
+  M(float,SharedPrecision<3>)
+
 // delta for advisors
 class CPFloatDelta : public Delta {
 private:
@@ -94,22 +398,30 @@ public:
 };
 
 /**
- * \brief Float domain.
+ * \brief Float domain with bounds of type \a B.
  *
  * A float domain is approximated by means of a greatest lower
- * bound \c glb and a least upper bound \c lub.
+ * bound \c glb and a least upper bound \c lub. The precision policy
+ * \a P decides when the domain is narrow enough to be assigned.
  */
-class CPFloatVarImp : public CPFloatVarImpBase {
+template <class B, class P=VarPrecision<B> >
+class CPFloatVarImpT : public CPFloatVarImpBase, protected P {
 protected:
-  /// Implementation for the interval
-  Interval  impl_;
-  BoundType presicion_;
+  /// Greatest lower bound
+  B l_;
+  /// Least upper bound
+  B u_;
+  /// Notifies the change of the bounds from [\a l, \a u]
+  ModEvent bounds(Space& home, B l, B u, ModEvent me) {
+    CPFloatDelta d(l,u);
+    return notify(home, assigned() ? ME_CPFLOAT_VAL : me, d);
+  }
 public:
   /// \a Constructors and disposer
   //@{
   /// Constructor for a variable with empty lower bound and
-  CPFloatVarImp(Space& home, BoundType l, BoundType u, BoundType p=0.000000001)
-    : CPFloatVarImpBase(home), impl_(l,u), presicion_(p) {}
+  CPFloatVarImpT(Space& home, B l, B u, const P& p=P())
+    : CPFloatVarImpBase(home), P(p), l_(l), u_(u) {}
   /// Resources disposal
   void dispose(Space&) {
     //std::cout << "Starting disposal" << std::endl;
@@ -118,62 +430,75 @@ public:
   /// \name Bound access
   //@{
   /// Returns a float representing the greatest lower bound of the variable
-  BoundType glb(void) const {
-    return impl_.lower();
+  B glb(void) const {
+    return l_;
   }
   /// Returns a float representing the least upper bound of the variable
-  BoundType lub(void) const {
-    return impl_.upper();
+  B lub(void) const {
+    return u_;
   }
   /// Returns the median of the interval
-  BoundType median(void) const {
-    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
-    return rnd.div_down( rnd.add_down(impl_.upper(),impl_.lower()) , 2.0);
+  B median(void) const {
+    boost::numeric::interval_lib::rounded_math<B> rnd;
+    return rnd.div_down( rnd.add_down(u_,l_) , 2.0);
   }
 
   //@}
   /// \name Pruning operations
   //@{
   /**
-   * \brief Prune the variable by doing: \f$ glb = glb \cup r \f$
+   * \brief Prune the variable by doing: \f$ glb = \max(glb,f) \f$
    *
+   * A NaN bound fails. Assigned variables are only checked for
+   * failure. The delta of all pruning operations is the previous
+   * domain.
    */
-  ModEvent geq(Space& home, BoundType f) {
-    if (assigned()) return ME_CPFLOAT_VAL;
-    if ( boost::numeric::interval_lib::cerge(impl_, f) ) {
-      return ME_CPFLOAT_NONE;
-    }
-    if ( !boost::numeric::interval_lib::posge(impl_, f) ) {
+  ModEvent geq(Space& home, B f) {
+    if (!(f <= u_))
       return ME_CPFLOAT_FAILED;
-    }
-
-    impl_ = boost::numeric::max(f, impl_);
-    CPFloatDelta d(impl_.lower(),f);
-    return notify(home, assigned() ? ME_CPFLOAT_VAL : ME_CPFLOAT_MIN, d);
+    if (f <= l_ || assigned())
+      return ME_CPFLOAT_NONE;
+    B l = l_;
+    l_ = f;
+    return bounds(home,l,u_,ME_CPFLOAT_MIN);
   }
   /**
-   * \brief Prune the variable by doing: \f$ lub = lub \setminus r \f$
+   * \brief Prune the variable by doing: \f$ lub = \min(lub,f) \f$
    *
    */
-  ModEvent leq(Space& home, BoundType f) {
-    if (assigned()) return ME_CPFLOAT_VAL;
-    if ( boost::numeric::interval_lib::cerle(impl_, f) ) {
+  ModEvent leq(Space& home, B f) {
+    if (!(f >= l_))
+      return ME_CPFLOAT_FAILED;
+    if (f >= u_ || assigned())
       return ME_CPFLOAT_NONE;
-    }
-    if ( !boost::numeric::interval_lib::posle(impl_, f) ) {
+    B u = u_;
+    u_ = f;
+    return bounds(home,l_,u,ME_CPFLOAT_MAX);
+  }
+  /**
+   * \brief Prune the variable to \f$ [\max(glb,l), \min(lub,u)] \f$
+   * with a single notification.
+   */
+  ModEvent narrow(Space& home, B l, B u) {
+    if (!(l <= u_) || !(u >= l_) || !(l <= u))
       return ME_CPFLOAT_FAILED;
-    }
-    impl_ = boost::numeric::min(impl_, f);
-    CPFloatDelta d(f,impl_.upper());
-    return notify(home, assigned() ? ME_CPFLOAT_VAL : ME_CPFLOAT_MAX, d);
+    bool min = l > l_;
+    bool max = u < u_;
+    if (!(min || max) || assigned())
+      return ME_CPFLOAT_NONE;
+    B ol = l_, ou = u_;
+    l_ = min ? l : l_;
+    u_ = max ? u : u_;
+    return bounds(home,ol,ou,
+                  min ? (max ? ME_CPFLOAT_BND : ME_CPFLOAT_MIN) : ME_CPFLOAT_MAX);
   }
   //@}
   /// \name Domain tests
   //@{
   /// Tests for assignment \f$ glb = lub \f$
   bool assigned(void) const {
-    //std::cout << " *** assigned() *** " << impl_.lower() << " " << impl_.upper() << " " << presicion_ << " Dif: " << impl_.upper()-impl_.lower() << std::endl;
-    return (impl_.upper()-impl_.lower()<presicion_);
+    //std::cout << " *** assigned() *** " << l_ << " " << u_ << " Dif: " << u_-l_ << std::endl;
+    return P::within(l_,u_);
   }
   //@}
   /// \name Subscriptions hadling
@@ -194,14 +519,14 @@ public:
   //@}
   /// \name Copying
   //@{
-  CPFloatVarImp(Space& home, bool share, CPFloatVarImp& y)
-    : CPFloatVarImpBase(home,share,y), impl_(y.impl_), presicion_(y.presicion_) {}
+  CPFloatVarImpT(Space& home, bool share, CPFloatVarImpT& y)
+    : CPFloatVarImpBase(home,share,y), P(y), l_(y.l_), u_(y.u_) {}
 
-  CPFloatVarImp* copy(Space& home, bool share) {
+  CPFloatVarImpT* copy(Space& home, bool share) {
     if (copied())
-      return static_cast<CPFloatVarImp*>(forward());
+      return static_cast<CPFloatVarImpT*>(forward());
     else
-      return new (home) CPFloatVarImp(home,share,*this);
+      return new (home) CPFloatVarImpT(home,share,*this);
   }
   //@}
   // delta information
@@ -213,25 +538,34 @@ public:
   }
 };
 
+/// Variable implementation with double bounds
+typedef CPFloatVarImpT<double> CPFloatVarImp;
+/// Variable implementation with single precision bounds
+typedef CPFloatVarImpT<float> CPFloatSingleVarImp;
+/// Variable implementation with double bounds and precision class 0
+typedef CPFloatVarImpT<double,SharedPrecision<0> > CPFloatCompactVarImp;
+
 }}
 
 // variable
 namespace MPG {
 
-class CPFloatVar : public VarImpVar<CPFloat::CPFloatVarImp> {
+template <class B, class P=CPFloat::VarPrecision<B> >
+class CPFloatVarT : public VarImpVar<CPFloat::CPFloatVarImpT<B,P> > {
 protected:
-  using VarImpVar<CPFloat::CPFloatVarImp>::x;
+  using VarImpVar<CPFloat::CPFloatVarImpT<B,P> >::x;
 public:
-  CPFloatVar(void) {}
-  CPFloatVar(const CPFloatVar& y)
-    : VarImpVar<CPFloat::CPFloatVarImp>(y.varimp()) {}
-  CPFloatVar(CPFloat::CPFloatVarImp *y)
-    : VarImpVar<CPFloat::CPFloatVarImp>(y) {}
+  CPFloatVarT(void) {}
+  CPFloatVarT(const CPFloatVarT& y)
+    : VarImpVar<CPFloat::CPFloatVarImpT<B,P> >(y.varimp()) {}
+  CPFloatVarT(CPFloat::CPFloatVarImpT<B,P> *y)
+    : VarImpVar<CPFloat::CPFloatVarImpT<B,P> >(y) {}
 
   // variable creation
-  CPFloatVar(Space& home, CPFloat::BoundType l, CPFloat::BoundType u, CPFloat::BoundType precision=0.0000000000001)
-    : VarImpVar<CPFloat::CPFloatVarImp>
-      (new (home) CPFloat::CPFloatVarImp(home,l,u,precision)) {
+  CPFloatVarT(Space& home, B l, B u,
+              const P& precision=P())
+    : VarImpVar<CPFloat::CPFloatVarImpT<B,P> >
+      (new (home) CPFloat::CPFloatVarImpT<B,P>(home,l,u,precision)) {
     if (l > u)
       throw CPFloat::VariableEmptyDomain("CPFloatVar::CPFloatVar");
   }
@@ -242,7 +576,7 @@ public:
    *
    * Returns a float (copy) that represents the lower bound of the variable.
    */
-  CPFloat::BoundType glb(void) const {
+  B glb(void) const {
     return x->glb();
   }
   /**
@@ -250,15 +584,22 @@ public:
    *
    * Returns a float (copy) that represents the upper bound of the variable.
    */
-  CPFloat::BoundType lub(void) const {
+  B lub(void) const {
     return x->lub();
   }
   //@}
 };
 
-template<class Char, class Traits>
+/// Variable with double bounds
+typedef CPFloatVarT<double> CPFloatVar;
+/// Variable with single precision bounds (half the memory of CPFloatVar)
+typedef CPFloatVarT<float> CPFloatSingleVar;
+/// Variable with double bounds whose precision is class 0 of the PrecisionTable
+typedef CPFloatVarT<double,CPFloat::SharedPrecision<0> > CPFloatCompactVar;
+
+template<class Char, class Traits, class B, class P>
 std::basic_ostream<Char,Traits>&
-operator <<(std::basic_ostream<Char,Traits>& os, const CPFloatVar& x) {
+operator <<(std::basic_ostream<Char,Traits>& os, const CPFloatVarT<B,P>& x) {
   std::basic_ostringstream<Char,Traits> s;
   s.copyfmt(os); s.width(0);
 
@@ -274,38 +615,39 @@ operator <<(std::basic_ostream<Char,Traits>& os, const CPFloatVar& x) {
 
 // array traits
 namespace MPG {
-class CPFloatVarArgs; class CPFloatVarArray;
+template <class B, class P=CPFloat::VarPrecision<B> > class CPFloatVarArgsT;
+template <class B, class P=CPFloat::VarPrecision<B> > class CPFloatVarArrayT;
 }
 
 namespace Gecode {
 
-template<>
-class ArrayTraits<Gecode::VarArray<MPG::CPFloatVar> > {
+template<class B, class P>
+class ArrayTraits<Gecode::VarArray<MPG::CPFloatVarT<B,P> > > {
 public:
-  typedef MPG::CPFloatVarArray  StorageType;
-  typedef MPG::CPFloatVar       ValueType;
-  typedef MPG::CPFloatVarArgs   ArgsType;
+  typedef MPG::CPFloatVarArrayT<B,P>  StorageType;
+  typedef MPG::CPFloatVarT<B,P>       ValueType;
+  typedef MPG::CPFloatVarArgsT<B,P>   ArgsType;
 };
-template<>
-class ArrayTraits<MPG::CPFloatVarArray> {
+template<class B, class P>
+class ArrayTraits<MPG::CPFloatVarArrayT<B,P> > {
 public:
-  typedef MPG::CPFloatVarArray  StorageType;
-  typedef MPG::CPFloatVar       ValueType;
-  typedef MPG::CPFloatVarArgs   ArgsType;
+  typedef MPG::CPFloatVarArrayT<B,P>  StorageType;
+  typedef MPG::CPFloatVarT<B,P>       ValueType;
+  typedef MPG::CPFloatVarArgsT<B,P>   ArgsType;
 };
-template<>
-class ArrayTraits<Gecode::VarArgArray<MPG::CPFloatVar> > {
+template<class B, class P>
+class ArrayTraits<Gecode::VarArgArray<MPG::CPFloatVarT<B,P> > > {
 public:
-  typedef MPG::CPFloatVarArgs   StorageType;
-  typedef MPG::CPFloatVar       ValueType;
-  typedef MPG::CPFloatVarArgs   ArgsType;
+  typedef MPG::CPFloatVarArgsT<B,P>   StorageType;
+  typedef MPG::CPFloatVarT<B,P>       ValueType;
+  typedef MPG::CPFloatVarArgsT<B,P>   ArgsType;
 };
-template<>
-class ArrayTraits<MPG::CPFloatVarArgs> {
+template<class B, class P>
+class ArrayTraits<MPG::CPFloatVarArgsT<B,P> > {
 public:
-  typedef MPG::CPFloatVarArgs  StorageType;
-  typedef MPG::CPFloatVar      ValueType;
-  typedef MPG::CPFloatVarArgs  ArgsType;
+  typedef MPG::CPFloatVarArgsT<B,P>  StorageType;
+  typedef MPG::CPFloatVarT<B,P>      ValueType;
+  typedef MPG::CPFloatVarArgsT<B,P>  ArgsType;
 };
 
 }
@@ -313,46 +655,68 @@ public:
 // variable arrays
 namespace MPG {
 /// Passing float variables
-class CPFloatVarArgs : public VarArgArray<CPFloatVar> {
+template <class B, class P>
+class CPFloatVarArgsT : public VarArgArray<CPFloatVarT<B,P> > {
 public:
-  CPFloatVarArgs(void) {}
-  explicit CPFloatVarArgs(int n) : VarArgArray<CPFloatVar>(n) {}
-  CPFloatVarArgs(const CPFloatVarArgs& a) : VarArgArray<CPFloatVar>(a) {}
-  CPFloatVarArgs(const VarArray<CPFloatVar>& a) : VarArgArray<CPFloatVar>(a) {}
-  CPFloatVarArgs(Space& home, int n, CPFloat::BoundType l, CPFloat::BoundType u)
-    : VarArgArray<CPFloatVar>(n) {
+  CPFloatVarArgsT(void) {}
+  explicit CPFloatVarArgsT(int n) : VarArgArray<CPFloatVarT<B,P> >(n) {}
+  CPFloatVarArgsT(const CPFloatVarArgsT& a) : VarArgArray<CPFloatVarT<B,P> >(a) {}
+  CPFloatVarArgsT(const VarArray<CPFloatVarT<B,P> >& a) : VarArgArray<CPFloatVarT<B,P> >(a) {}
+  CPFloatVarArgsT(Space& home, int n, B l, B u)
+    : VarArgArray<CPFloatVarT<B,P> >(n) {
     for (int i=0; i<n; i++)
-      (*this)[i] = CPFloatVar(home,l,u);
+      (*this)[i] = CPFloatVarT<B,P>(home,l,u);
   }
 };
 
-class CPFloatVarArray : public VarArray<CPFloatVar> {
+template <class B, class P>
+class CPFloatVarArrayT : public VarArray<CPFloatVarT<B,P> > {
 public:
-  CPFloatVarArray(void) {}
-  CPFloatVarArray(const CPFloatVarArray& a)
-    : VarArray<CPFloatVar>(a) {}
-  CPFloatVarArray(Space& home, int n, CPFloat::BoundType l, CPFloat::BoundType u, CPFloat::BoundType precision=0.000000001)
-    : VarArray<CPFloatVar>(home,n) {
+  CPFloatVarArrayT(void) {}
+  CPFloatVarArrayT(const CPFloatVarArrayT& a)
+    : VarArray<CPFloatVarT<B,P> >(a) {}
+  CPFloatVarArrayT(Space& home, int n, B l, B u,
+                   const P& precision=P::array_default())
+    : VarArray<CPFloatVarT<B,P> >(home,n) {
     for (int i=0; i<n; i++)
-      (*this)[i] = CPFloatVar(home,l,u,precision);
+      (*this)[i] = CPFloatVarT<B,P>(home,l,u,precision);
   }
 };
 
+typedef CPFloatVarArgsT<double> CPFloatVarArgs;
+typedef CPFloatVarArrayT<double> CPFloatVarArray;
+typedef CPFloatVarArgsT<float> CPFloatSingleVarArgs;
+typedef CPFloatVarArrayT<float> CPFloatSingleVarArray;
+typedef CPFloatVarArgsT<double,CPFloat::SharedPrecision<0> > CPFloatCompactVarArgs;
+typedef CPFloatVarArrayT<double,CPFloat::SharedPrecision<0> > CPFloatCompactVarArray;
+
+/// Passing coefficients and constants as arguments
+typedef Gecode::ArgArray<CPFloat::BoundType> CPFloatArgs;
+/// Passing exponents as arguments
+typedef Gecode::ArgArray<int> CPFloatIntArgs;
+
 }
 
 // float view
 namespace MPG { namespace CPFloat {
-/// Float view for float variables
-class CPFloatView : public VarImpView<CPFloatVar> {
+/**
+ * \brief Float view for float variables with bounds of type \a B
+ *
+ * Bounds are read and written as \ref BoundType, the view rounds new
+ * bounds outwards to \a B. Propagators and branchers written against
+ * this interface work for any bound type.
+ */
+template <class B, class P=VarPrecision<B> >
+class CPFloatViewT : public VarImpView<CPFloatVarT<B,P> > {
 protected:
-  using VarImpView<CPFloatVar>::x;
+  using VarImpView<CPFloatVarT<B,P> >::x;
 public:
-  CPFloatView(void) {}
-  CPFloatView(const CPFloatVar& y)
-    : VarImpView<CPFloatVar>(y.varimp()) {
+  CPFloatViewT(void) {}
+  CPFloatViewT(const CPFloatVarT<B,P>& y)
+    : VarImpView<CPFloatVarT<B,P> >(y.varimp()) {
     }
-  CPFloatView(CPFloatVarImp* y)
-    : VarImpView<CPFloatVar>(y) {}
+  CPFloatViewT(CPFloatVarImpT<B,P>* y)
+    : VarImpView<CPFloatVarT<B,P> >(y) {}
   // access operations
   BoundType glb(void) const {
     return x->glb();
@@ -366,26 +730,36 @@ public:
 
   // modification operations
   ModEvent geq(Space& home, BoundType f) {
-    return x->geq(home,f);
+    return x->geq(home,BoundTraits<B>::down(f));
   }
   ModEvent leq(Space& home, BoundType f) {
-    return x->leq(home,f);
+    return x->leq(home,BoundTraits<B>::up(f));
+  }
+  ModEvent narrow(Space& home, BoundType l, BoundType u) {
+    return x->narrow(home,BoundTraits<B>::down(l),BoundTraits<B>::up(u));
   }
   // delta information
   int min(const Delta& d) const {
-    return CPFloatVarImp::min(d);
+    return CPFloatVarImpT<B,P>::min(d);
   }
   int max(const Delta& d) const {
-    return CPFloatVarImp::max(d);
+    return CPFloatVarImpT<B,P>::max(d);
   }
-  bool operator==(CPFloatView v) {
+  bool operator==(CPFloatViewT v) {
     return (x == v.x);
   }
 };
 
-template<class Char, class Traits>
+/// View on variables with double bounds
+typedef CPFloatViewT<double> CPFloatView;
+/// View on variables with single precision bounds
+typedef CPFloatViewT<float> CPFloatSingleView;
+/// View on variables with double bounds and precision class 0
+typedef CPFloatViewT<double,SharedPrecision<0> > CPFloatCompactView;
+
+template<class Char, class Traits, class B, class P>
 std::basic_ostream<Char,Traits>&
-operator<<(std::basic_ostream<Char,Traits>& os, const CPFloatView& x) {
+operator<<(std::basic_ostream<Char,Traits>& os, const CPFloatViewT<B,P>& x) {
   std::basic_ostringstream<Char,Traits> s;
   s.copyfmt(os); s.width(0);
   s << "{" << x.glb() << " " << x.lub() << "}";
@@ -398,27 +772,329 @@ operator<<(std::basic_ostream<Char,Traits>& os, const CPFloatView& x) {
 }
 }
 
+// derived views
+namespace MPG { namespace CPFloat {
+/**
+ * \brief Offset view: \f$ x + c \f$
+ *
+ * Bounds are rounded outwards, so no solution of the base view is
+ * removed.
+ */
+template <class View>
+class OffsetView : public DerivedView<View> {
+protected:
+  using DerivedView<View>::x;
+  /// Offset
+  BoundType c_;
+public:
+  OffsetView(void) : c_(0.0) {}
+  OffsetView(const View& y, BoundType c)
+    : DerivedView<View>(y), c_(c) {}
+  // access operations
+  BoundType offset(void) const {
+    return c_;
+  }
+  BoundType glb(void) const {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return rnd.add_down(x.glb(),c_);
+  }
+  BoundType lub(void) const {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return rnd.add_up(x.lub(),c_);
+  }
+  BoundType median(void) const {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return rnd.add_down(x.median(),c_);
+  }
+  // modification operations
+  ModEvent geq(Space& home, BoundType f) {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return x.geq(home,rnd.sub_down(f,c_));
+  }
+  ModEvent leq(Space& home, BoundType f) {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return x.leq(home,rnd.sub_up(f,c_));
+  }
+  ModEvent narrow(Space& home, BoundType l, BoundType u) {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return x.narrow(home,rnd.sub_down(l,c_),rnd.sub_up(u,c_));
+  }
+  void update(Space& home, bool share, OffsetView& y) {
+    DerivedView<View>::update(home,share,y);
+    c_ = y.c_;
+  }
+};
+
+/**
+ * \brief Scale view: \f$ a \cdot x \f$ for \f$ a > 0 \f$
+ *
+ * Bounds are rounded outwards, so no solution of the base view is
+ * removed.
+ */
+template <class View>
+class ScaleView : public DerivedView<View> {
+protected:
+  using DerivedView<View>::x;
+  /// Scale factor
+  BoundType a_;
+public:
+  ScaleView(void) : a_(1.0) {}
+  ScaleView(const View& y, BoundType a)
+    : DerivedView<View>(y), a_(a) {
+    if (!(a > 0.0))
+      throw OutOfLimits("CPFloat::ScaleView");
+  }
+  // access operations
+  BoundType scale(void) const {
+    return a_;
+  }
+  BoundType glb(void) const {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return rnd.mul_down(x.glb(),a_);
+  }
+  BoundType lub(void) const {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return rnd.mul_up(x.lub(),a_);
+  }
+  BoundType median(void) const {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return rnd.mul_down(x.median(),a_);
+  }
+  // modification operations
+  ModEvent geq(Space& home, BoundType f) {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return x.geq(home,rnd.div_down(f,a_));
+  }
+  ModEvent leq(Space& home, BoundType f) {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return x.leq(home,rnd.div_up(f,a_));
+  }
+  ModEvent narrow(Space& home, BoundType l, BoundType u) {
+    boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+    return x.narrow(home,rnd.div_down(l,a_),rnd.div_up(u,a_));
+  }
+  void update(Space& home, bool share, ScaleView& y) {
+    DerivedView<View>::update(home,share,y);
+    a_ = y.a_;
+  }
+};
+
+/// Minus view: \f$ -x \f$
+template <class View>
+class MinusView : public DerivedView<View> {
+protected:
+  using DerivedView<View>::x;
+public:
+  MinusView(void) {}
+  MinusView(const View& y)
+    : DerivedView<View>(y) {}
+  // access operations
+  BoundType glb(void) const {
+    return -x.lub();
+  }
+  BoundType lub(void) const {
+    return -x.glb();
+  }
+  BoundType median(void) const {
+    return -x.median();
+  }
+  // modification operations
+  ModEvent geq(Space& home, BoundType f) {
+    return x.leq(home,-f);
+  }
+  ModEvent leq(Space& home, BoundType f) {
+    return x.geq(home,-f);
+  }
+  ModEvent narrow(Space& home, BoundType l, BoundType u) {
+    return x.narrow(home,-u,-l);
+  }
+};
+
+/**
+ * \brief Constant view: \f$ c \f$
+ *
+ * Pruning beyond the constant fails, any other pruning has no effect.
+ */
+class ConstCPFloatView : public ConstView<CPFloatView> {
+protected:
+  /// The constant
+  BoundType c_;
+public:
+  ConstCPFloatView(void) : c_(0.0) {}
+  ConstCPFloatView(BoundType c) : c_(c) {}
+  // access operations
+  BoundType glb(void) const {
+    return c_;
+  }
+  BoundType lub(void) const {
+    return c_;
+  }
+  BoundType median(void) const {
+    return c_;
+  }
+  // modification operations
+  ModEvent geq(Space&, BoundType f) {
+    return (f <= c_) ? ME_CPFLOAT_NONE : ME_CPFLOAT_FAILED;
+  }
+  ModEvent leq(Space&, BoundType f) {
+    return (f >= c_) ? ME_CPFLOAT_NONE : ME_CPFLOAT_FAILED;
+  }
+  ModEvent narrow(Space&, BoundType l, BoundType u) {
+    return (l <= c_ && c_ <= u) ? ME_CPFLOAT_NONE : ME_CPFLOAT_FAILED;
+  }
+  void update(Space& home, bool share, ConstCPFloatView& y) {
+    ConstView<CPFloatView>::update(home,share,y);
+    c_ = y.c_;
+  }
+};
+
+}}
+
+#include <cpfloat/union.hh>
 #include <cpfloat/expression.hh>
 namespace MPG {
 
-  void branch(Gecode::Home home, CPFloatVar x);
-  void firstfail(Gecode::Home home, const CPFloatVarArgs& x);
-  void naive(Gecode::Home home, const CPFloatVarArgs& x);
-  void randselection(Gecode::Home home, const CPFloatVarArgs& x);
-  void sin(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void cos(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void tan(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void asin(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void acos(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void atan(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void equality(Gecode::Space& home, CPFloatVar x, CPFloatVar y);
-  void addition(Gecode::Space& home, CPFloatVar x, CPFloatVar y, CPFloatVar z);
-  void subtraction(Gecode::Space& home, CPFloatVar x, CPFloatVar y, CPFloatVar z);
-  void times(Gecode::Space& home, CPFloatVar x, CPFloatVar y, CPFloatVar z);
-  void power(Gecode::Space& home, CPFloatVar x, int e, CPFloatVar y);
+  template <class B, class P>
+  void branch(Gecode::Home home, CPFloatVarT<B,P> x);
+  template <class B, class P>
+  void firstfail(Gecode::Home home, const CPFloatVarArgsT<B,P>& x);
+  template <class B, class P>
+  void firstfail(Gecode::Home home, const CPFloatVarArrayT<B,P>& x) {
+    firstfail(home,CPFloatVarArgsT<B,P>(x));
+  }
+  template <class B, class P>
+  void naive(Gecode::Home home, const CPFloatVarArgsT<B,P>& x);
+  template <class B, class P>
+  void naive(Gecode::Home home, const CPFloatVarArrayT<B,P>& x) {
+    naive(home,CPFloatVarArgsT<B,P>(x));
+  }
+  template <class B, class P>
+  void branch(Gecode::Home home, const CPFloatVarArgsT<B,P>& x,
+              const CPFloat::CPFloatVarTieBreak& vars, CPFloat::CPFloatValBranch vals,
+              CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO, int k=2);
+  template <class B, class P>
+  void branch(Gecode::Home home, const CPFloatVarArgsT<B,P>& x,
+              CPFloat::CPFloatVarBranch vars, CPFloat::CPFloatValBranch vals,
+              CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO, int k=2) {
+    branch(home,x,CPFloat::tiebreak(vars,CPFloat::CPFLOAT_VAR_NONE),vals,ratio,k);
+  }
+  template <class B, class P>
+  void branch(Gecode::Home home, const CPFloatVarArrayT<B,P>& x,
+              const CPFloat::CPFloatVarTieBreak& vars, CPFloat::CPFloatValBranch vals,
+              CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO, int k=2) {
+    branch(home,CPFloatVarArgsT<B,P>(x),vars,vals,ratio,k);
+  }
+  template <class B, class P>
+  void branch(Gecode::Home home, const CPFloatVarArrayT<B,P>& x,
+              CPFloat::CPFloatVarBranch vars, CPFloat::CPFloatValBranch vals,
+              CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO, int k=2) {
+    branch(home,CPFloatVarArgsT<B,P>(x),vars,vals,ratio,k);
+  }
+  template <class B, class P>
+  void randselection(Gecode::Home home, const CPFloatVarArgsT<B,P>& x,
+                     unsigned int seed=1,
+                     CPFloat::CPFloatValBranch vals=CPFloat::CPFLOAT_VAL_SPLIT_MAX,
+                     CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO,
+                     int k=2);
+  template <class B, class P>
+  void randselection(Gecode::Home home, const CPFloatVarArrayT<B,P>& x,
+                     unsigned int seed=1,
+                     CPFloat::CPFloatValBranch vals=CPFloat::CPFLOAT_VAL_SPLIT_MAX,
+                     CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO,
+                     int k=2) {
+    randselection(home,CPFloatVarArgsT<B,P>(x),seed,vals,ratio,k);
+  }
+  template <class B, class P>
+  void sin(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void cos(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void sincos(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> s, CPFloatVarT<B,P> c);
+  template <class B, class P>
+  void tan(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void asin(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void acos(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void atan(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void exp(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void log(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void sqrt(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void abs(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void sgn(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void min(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void max(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void equality(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void equality(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloat::BoundType c);
+  template <class B, class P>
+  void negation(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void addition(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void addition(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloat::BoundType c, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void subtraction(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void subtraction(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloat::BoundType c, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void times(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void times(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloat::BoundType c, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void division(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z);
+  template <class B, class P>
+  void power(Gecode::Space& home, CPFloatVarT<B,P> x, int e, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void linear(Gecode::Space& home, const CPFloatArgs& a, const CPFloatVarArgsT<B,P>& x,
+              CPFloat::CPFloatRelType r, CPFloat::BoundType c);
+  template <class B, class P>
+  void linear(Gecode::Space& home, const CPFloatArgs& a, const CPFloatVarArrayT<B,P>& x,
+              CPFloat::CPFloatRelType r, CPFloat::BoundType c) {
+    linear(home,a,CPFloatVarArgsT<B,P>(x),r,c);
+  }
+  template <class B, class P>
+  void polynomial(Gecode::Space& home, const CPFloatArgs& c, const CPFloatIntArgs& e,
+                  const CPFloatVarArgsT<B,P>& x, CPFloat::CPFloatRelType r,
+                  CPFloat::BoundType rhs);
+  template <class B, class P>
+  void polynomial(Gecode::Space& home, const CPFloatArgs& c, const CPFloatIntArgs& e,
+                  const CPFloatVarArrayT<B,P>& x, CPFloat::CPFloatRelType r,
+                  CPFloat::BoundType rhs) {
+    polynomial(home,c,e,CPFloatVarArgsT<B,P>(x),r,rhs);
+  }
 
   void hc4(Gecode::Space& home, CPFloat::Constraint& cst);
   void k3b(Gecode::Space& home, CPFloat::Constraint& cst);
+  void smear(Gecode::Home home, const CPFloatVarArgs& x, const CPFloat::ConstraintArgs& c,
+             const CPFloat::CPFloatVarTieBreak& vars, CPFloat::CPFloatValBranch vals,
+             CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO, int k=2);
+  inline void
+  smear(Gecode::Home home, const CPFloatVarArgs& x, const CPFloat::ConstraintArgs& c,
+        CPFloat::CPFloatVarBranch vars, CPFloat::CPFloatValBranch vals,
+        CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO, int k=2) {
+    smear(home,x,c,CPFloat::tiebreak(vars,CPFloat::CPFLOAT_VAR_NONE),vals,ratio,k);
+  }
+  void wdeg(Gecode::Home home, const CPFloatVarArgs& x, const CPFloat::ConstraintArgs& c,
+            const CPFloat::CPFloatVarTieBreak& vars, CPFloat::CPFloatValBranch vals,
+            double decay=1.0, CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO,
+            int k=2);
+  inline void
+  wdeg(Gecode::Home home, const CPFloatVarArgs& x, const CPFloat::ConstraintArgs& c,
+       CPFloat::CPFloatVarBranch vars, CPFloat::CPFloatValBranch vals,
+       double decay=1.0, CPFloat::BoundType ratio=CPFloat::CPFLOAT_SPLIT_RATIO,
+       int k=2) {
+    wdeg(home,x,c,CPFloat::tiebreak(vars,CPFloat::CPFLOAT_VAR_NONE),vals,decay,ratio,k);
+  }
 
 }
 
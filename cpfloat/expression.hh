@@ -75,6 +75,8 @@ public:
   virtual int   countViews();
   virtual void  collectViews(ViewArray<CPFloatView>& views,int& i);
   virtual INTERVAL evaluate();
+  virtual INTERVAL derivative(const CPFloatView& x);
+  virtual void  substitute(const CPFloatView& x, const INTERVAL* xi);
   virtual Gecode::ExecStatus propagate(Gecode::Space& home,INTERVAL interval);
   INTERVAL getInteval();
   Expression& sin();
@@ -98,6 +100,8 @@ public:
 class VarExpression : public Expression {
 private:
   CPFloat::CPFloatView v_;
+  /// Interval evaluated in place of the domain of v_, see substitute()
+  const INTERVAL* sub_;
 public:
   VarExpression(CPFloatVar v);
   VarExpression(CPFloatView v);
@@ -114,6 +118,8 @@ public:
   int   countViews();
   void  collectViews(ViewArray<CPFloatView>& views,int& i);
   INTERVAL evaluate();
+  INTERVAL derivative(const CPFloatView& x);
+  void  substitute(const CPFloatView& x, const INTERVAL* xi);
   Gecode::ExecStatus propagate(Gecode::Space& home,INTERVAL interval);
 };
 
@@ -137,6 +143,8 @@ public:
   int   countViews();
   void  collectViews(ViewArray<CPFloatView>& views,int& i);
   INTERVAL evaluate();
+  INTERVAL derivative(const CPFloatView& x);
+  void  substitute(const CPFloatView& x, const INTERVAL* xi);
   Gecode::ExecStatus propagate(Gecode::Space& home,INTERVAL interval);
 };
 
@@ -146,6 +154,8 @@ class UnaryExpression : public Expression {
 private:
   Expression& expr_;
   ExprType    type_;
+  /// Cached range reductions of the bounds of the argument (SIN, COS)
+  TRIG_REDUCTION lo_, hi_;
   UnaryExpression(Expression& expr, ExprType type);
 public:
   ~UnaryExpression();
@@ -161,6 +171,8 @@ public:
   int   countViews();
   void  collectViews(ViewArray<CPFloatView>& views,int& i);
   INTERVAL evaluate();
+  INTERVAL derivative(const CPFloatView& x);
+  void  substitute(const CPFloatView& x, const INTERVAL* xi);
   Gecode::ExecStatus propagate(Gecode::Space& home,INTERVAL interval);
 friend class Expression;
 };
@@ -187,6 +199,8 @@ public:
   int   countViews();
   void  collectViews(ViewArray<CPFloatView>& views,int& i);
   INTERVAL evaluate();
+  INTERVAL derivative(const CPFloatView& x);
+  void  substitute(const CPFloatView& x, const INTERVAL* xi);
   Gecode::ExecStatus propagate(Gecode::Space& home,INTERVAL interval);
 friend class Expression;
 friend Expression& operator+(BoundType c,Expression& expr);
@@ -197,12 +211,130 @@ friend Expression& operator/(BoundType c,Expression& expr);
 
 //--------------------------------------------------------------------------
 
+/**
+ * \brief Failure weight of a constraint
+ *
+ * Handle shared by the clones of a constraint, so the failures of its
+ * propagators in one branch of the search are seen by the branchers of
+ * the others (spaces copied without sharing, as by the parallel
+ * engines, get their own weights). Failures are only recorded once
+ * wdeg() has attached a Clock to the weight. The weight starts at 1 and
+ * every failure adds 1. With a decay \f$ d < 1 \f$ the weight is also
+ * multiplied by \f$ d \f$ at every failure of any constraint with the
+ * same clock, so recent failures count more. The decay is applied
+ * lazily from the clock.
+ */
+class Weight : public Gecode::SharedHandle {
+public:
+  /// Failure count of the constraints of one wdeg() brancher
+  class Clock : public Gecode::SharedHandle {
+  protected:
+    /// Failure count
+    class Object : public Gecode::SharedHandle::Object {
+    public:
+      /// Failures so far
+      unsigned long int t_;
+      /// Constructor
+      Object(unsigned long int t) : t_(t) {}
+      /// Copy
+      virtual Gecode::SharedHandle::Object* copy(void) const {
+        return new Object(t_);
+      }
+    };
+  public:
+    /// Constructor for no clock
+    Clock(void) {}
+    /// Constructor for a clock at time \a t
+    explicit Clock(unsigned long int t)
+      : Gecode::SharedHandle(new Object(t)) {}
+    /// Whether the clock exists
+    bool valid(void) const {
+      return object() != NULL;
+    }
+    /// Returns the time
+    unsigned long int now(void) const {
+      return static_cast<Object*>(object())->t_;
+    }
+    /// Advances the time and returns it
+    unsigned long int tick(void) {
+      return ++static_cast<Object*>(object())->t_;
+    }
+  };
+protected:
+  /// Weight and decay
+  class Object : public Gecode::SharedHandle::Object {
+  public:
+    /// Weight at time t_
+    double w_;
+    /// Failure clock of the last update
+    unsigned long int t_;
+    /// Decay
+    double d_;
+    /// Clock, none while failures are not recorded
+    Clock c_;
+    /// Constructor
+    Object(double w, unsigned long int t, double d)
+      : w_(w), t_(t), d_(d) {}
+    /// Copy, the clock is updated by Weight::update
+    virtual Gecode::SharedHandle::Object* copy(void) const {
+      return new Object(w_,t_,d_);
+    }
+    /// Weight at time \a t
+    double at(unsigned long int t) const {
+      return (d_ < 1.0) ? w_*std::pow(d_,static_cast<double>(t-t_)) : w_;
+    }
+  };
+public:
+  /// Constructor for no weight
+  Weight(void) {}
+  /// Constructor for a weight with decay \a d
+  explicit Weight(double d)
+    : Gecode::SharedHandle(new Object(1.0,0,d)) {}
+  /// Updating during cloning
+  void update(Gecode::Space& home, bool share, Weight& w) {
+    Gecode::SharedHandle::update(home,share,w);
+    if (share || (object() == NULL))
+      return;
+    // a weight reached through several handles is copied once
+    Object* o = static_cast<Object*>(object());
+    if (!o->c_.valid())
+      o->c_.update(home,share,static_cast<Object*>(w.object())->c_);
+  }
+  /// Record a failure
+  void fail(void) {
+    Object* o = static_cast<Object*>(object());
+    if ((o == NULL) || !o->c_.valid())
+      return;
+    unsigned long int t = o->c_.tick();
+    o->w_ = o->at(t) + 1.0;
+    o->t_ = t;
+  }
+  /// Returns the current weight
+  double weight(void) const {
+    Object* o = static_cast<Object*>(object());
+    return o->c_.valid() ? o->at(o->c_.now()) : o->w_;
+  }
+  /// Record failures on the clock \a c with decay \a d
+  void enable(const Clock& c, double d) {
+    Object* o = static_cast<Object*>(object());
+    if (o->c_.valid())
+      o->w_ = o->at(o->c_.now());
+    o->c_ = c;
+    o->t_ = c.now();
+    o->d_ = d;
+  }
+};
+
+//--------------------------------------------------------------------------
+
 class Constraint {
 private:
   Expression& left_;
   Expression& right_;
   RelType     type_;
-  Constraint(Expression& left, Expression& right, RelType type);
+  Weight      weight_;
+  Constraint(Expression& left, Expression& right, RelType type,
+             const Weight& weight);
 public:
   ~Constraint();
   ClassType getClass() const;
@@ -217,11 +349,19 @@ public:
   int   countViews();
   void  collectViews(ViewArray<CPFloatView>& views);
   void  evaluate();
+  INTERVAL derivative(const CPFloatView& x);
+  void  substitute(const CPFloatView& x, const INTERVAL* xi);
+  INTERVAL residual();
   Gecode::ExecStatus propagate(Gecode::Space& home);
+  Weight& weight();
+  void  fail();
 friend class Expression;
 friend Constraint& operator==(BoundType c,Expression& expr);
 };
 
+/// Passing constraints as arguments
+typedef Gecode::ArgArray<Constraint*> ConstraintArgs;
+
 }}
 
 //--------------------------------------------------------------------------
@@ -397,21 +537,21 @@ forceinline
 Constraint& Expression::operator==(Expression& expr) {
   Expression& left = getClass()==VAR ? this->clone() : *this;
   Expression& right = expr.getClass()==VAR ? expr.clone() : expr;
-  return *(new Constraint(left,right,EQUAL));
+  return *(new Constraint(left,right,EQUAL,Weight(1.0)));
 }
 
 forceinline
 Constraint& Expression::operator==(BoundType expr) {
   Expression& left = getClass()==VAR ? this->clone() : *this;
   Expression& right = *(new ConstExpression(expr));
-  return *(new Constraint(left,right,EQUAL));
+  return *(new Constraint(left,right,EQUAL,Weight(1.0)));
 }
 
 forceinline
 Constraint& operator==(BoundType c,Expression& expr) {
   Expression& left = *(new ConstExpression(c));
   Expression& right = expr.getClass()==VAR ? expr.clone() : expr;
-  return *(new Constraint(left,right,EQUAL));
+  return *(new Constraint(left,right,EQUAL,Weight(1.0)));
 }
 
 forceinline
@@ -437,6 +577,17 @@ INTERVAL Expression::evaluate() {
   return interval_;
 }
 
+forceinline
+INTERVAL Expression::derivative(const CPFloatView&) {
+  cout << " *** Warning *** Expression Method used (derivative(...))" << endl;
+  return cnstDI(0.0);
+}
+
+forceinline
+void Expression::substitute(const CPFloatView&, const INTERVAL*) {
+  cout << " *** Warning *** Expression Method used (substitute(...))" << endl;
+}
+
 forceinline
 Gecode::ExecStatus Expression::propagate(Gecode::Space& ,INTERVAL ) {
   cout << " *** Warning *** Expression Method used (propagate(...))" << endl;
@@ -447,12 +598,12 @@ Gecode::ExecStatus Expression::propagate(Gecode::Space& ,INTERVAL ) {
 
 forceinline
 VarExpression::VarExpression(CPFloatVar v)
-  : Expression(),v_(CPFloat::CPFloatView(v)) {
+  : Expression(),v_(CPFloat::CPFloatView(v)),sub_(NULL) {
 }
 
 forceinline
 VarExpression::VarExpression(CPFloatView v)
-  : Expression(),v_(v) {
+  : Expression(),v_(v),sub_(NULL) {
 }
 
 forceinline
@@ -527,16 +678,30 @@ void VarExpression::collectViews(ViewArray<CPFloatView>& views,int& i) {
 
 forceinline
 INTERVAL VarExpression::evaluate() {
+  if (sub_ != NULL) {
+    interval_ = *sub_;
+    return interval_;
+  }
   interval_.lo = v_.glb();
   interval_.hi = v_.lub();
   return interval_;
 }
 
+forceinline
+INTERVAL VarExpression::derivative(const CPFloatView& x) {
+  return (v_ == x) ? cnstDI(1.0) : cnstDI(0.0);
+}
+
+forceinline
+void VarExpression::substitute(const CPFloatView& x, const INTERVAL* xi) {
+  if (v_ == x)
+    sub_ = xi;
+}
+
 forceinline
 Gecode::ExecStatus VarExpression::propagate(Gecode::Space& home,INTERVAL interval) {
   interval_ = interval;
-  GECODE_ME_CHECK(v_.leq(home,interval_.hi));
-  GECODE_ME_CHECK(v_.geq(home,interval_.lo));
+  GECODE_ME_CHECK(v_.narrow(home,interval_.lo,interval_.hi));
   return Gecode::ES_NOFIX;
 }
 
@@ -609,6 +774,14 @@ INTERVAL ConstExpression::evaluate() {
   return interval_;
 }
 
+forceinline
+INTERVAL ConstExpression::derivative(const CPFloatView&) {
+  return cnstDI(0.0);
+}
+
+forceinline
+void ConstExpression::substitute(const CPFloatView&, const INTERVAL*) {}
+
 forceinline
 Gecode::ExecStatus ConstExpression::propagate(Gecode::Space& ,INTERVAL ) {
   return Gecode::ES_NOFIX;
@@ -619,6 +792,8 @@ Gecode::ExecStatus ConstExpression::propagate(Gecode::Space& ,INTERVAL ) {
 forceinline
 UnaryExpression::UnaryExpression(Expression &expr, ExprType type)
   : Expression(), expr_(expr), type_(type) {
+  trig_reduction_init(&lo_);
+  trig_reduction_init(&hi_);
 }
 
 forceinline
@@ -701,10 +876,10 @@ INTERVAL UnaryExpression::evaluate() {
 
   switch(type_) {
   case SIN:
-    narrow_sin(&x,&z);
+    intersect_sin_cachedII(x,&z,&lo_,&hi_);
     break;
   case COS:
-    narrow_cos(&x,&z);
+    intersect_cos_cachedII(x,&z,&lo_,&hi_);
     break;
   case SQRT:
     z = sqrtII(x);
@@ -716,6 +891,30 @@ INTERVAL UnaryExpression::evaluate() {
   return z;
 }
 
+forceinline
+void UnaryExpression::substitute(const CPFloatView& x, const INTERVAL* xi) {
+  expr_.substitute(x,xi);
+}
+
+forceinline
+INTERVAL UnaryExpression::derivative(const CPFloatView& x) {
+  INTERVAL dx = expr_.derivative(x);
+  if (dx.lo == 0.0 && dx.hi == 0.0)
+    return dx;
+  INTERVAL a = expr_.getInteval();
+
+  switch(type_) {
+  case SIN:
+    return mulIII(cosII(a),dx);
+  case COS:
+    return negII(mulIII(sinII(a),dx));
+  case SQRT:
+    return divIII(dx,mulIDI(interval_,2.0)); // (sqrt a)' = a'/(2 sqrt a)
+  default:
+    return cnstDI(0.0);
+  }
+}
+
 forceinline
 Gecode::ExecStatus UnaryExpression::propagate(Gecode::Space& home,INTERVAL interval) {
   INTERVAL z = interval;
@@ -723,10 +922,10 @@ Gecode::ExecStatus UnaryExpression::propagate(Gecode::Space& home,INTERVAL inter
 
   switch(type_) {
   case SIN:
-    intersect_inv_sinII(z,&x);  //sin(x)=z
+    intersect_inv_sin_cachedII(z,&x,&lo_,&hi_);  //sin(x)=z
     break;
   case COS:
-    intersect_inv_cosII(z,&x);  //cos(x)=z
+    intersect_inv_cos_cachedII(z,&x,&lo_,&hi_);  //cos(x)=z
     break;
   case SQRT:
     x = intersectIII(x,squareII(z)); //sqrt(x)=z
@@ -856,29 +1055,7 @@ INTERVAL BinaryExpression::evaluate() {
     break;
 
   case POW:
-    interval_.lo = BOUNDTYPE_MIN;
-    interval_.hi = BOUNDTYPE_MAX;
-    if ((int)right.lo%2 == 0) {
-      if (right.lo == 0.0) {
-        interval_.lo = 1.0;
-        interval_.hi = 1.0;
-      }
-      else if (right.lo == 2.0) {
-        interval_ = squareII(left);
-        if (interval_.lo<0.0) interval_.lo = 0.0;
-      }
-      else {
-        narrow_pow_even(&left,&right,&interval_);
-      }
-    }
-    else {
-      if (right.lo == 1.0) {
-        interval_ = right;
-      }
-      else {
-        narrow_pow_odd(&left,&right,&interval_);
-      }
-    }
+    interval_ = pow_intII(left,(int)right.lo);
     break;
 
   default:
@@ -887,6 +1064,39 @@ INTERVAL BinaryExpression::evaluate() {
   return interval_;
 }
 
+forceinline
+void BinaryExpression::substitute(const CPFloatView& x, const INTERVAL* xi) {
+  left_.substitute(x,xi);
+  right_.substitute(x,xi);
+}
+
+forceinline
+INTERVAL BinaryExpression::derivative(const CPFloatView& x) {
+  INTERVAL dl = left_.derivative(x);
+  INTERVAL dr = right_.derivative(x);
+  INTERVAL l = left_.getInteval();
+  INTERVAL r = right_.getInteval();
+  int n;
+
+  switch(type_) {
+  case ADD:
+    return addIII(dl,dr);
+  case SUB:
+    return subIII(dl,dr);
+  case MUL:
+    return addIII(mulIII(dl,r),mulIII(l,dr));
+  case DIV:
+    return divIII(subIII(mulIII(dl,r),mulIII(l,dr)),squareII(r));
+  case POW:
+    n = (int)r.lo;
+    if (n == 0)
+      return cnstDI(0.0);
+    return mulIII(mulIDI(pow_intII(l,n-1),n),dl);
+  default:
+    return cnstDI(0.0);
+  }
+}
+
 forceinline
 Gecode::ExecStatus BinaryExpression::propagate(Gecode::Space& home,INTERVAL interval) {
   INTERVAL z = interval;
@@ -915,17 +1125,7 @@ Gecode::ExecStatus BinaryExpression::propagate(Gecode::Space& home,INTERVAL inte
     break;
 
   case POW:
-    if ((int)y.lo%2==0) {
-      if (y.lo == 2.0) {
-        narrow_square(&x,&z); //x^2=z
-      }
-      else {
-        narrow_pow_even(&x,&y,&z);  //x^y=z | y is even
-      }
-    }
-    else {
-      narrow_pow_odd(&x,&y,&z); //x^y=z | y is odd
-    }
+    narrow_pow_int(&x,(int)y.lo,&z); //x^y=z
     break;
 
   default:
@@ -941,8 +1141,9 @@ Gecode::ExecStatus BinaryExpression::propagate(Gecode::Space& home,INTERVAL inte
 //--------------------------------------------------------------------------
 
 forceinline
-Constraint::Constraint(Expression& left, Expression& right, RelType type)
-  : left_(left), right_(right), type_(type) {
+Constraint::Constraint(Expression& left, Expression& right, RelType type,
+                       const Weight& weight)
+  : left_(left), right_(right), type_(type), weight_(weight) {
 }
 
 forceinline
@@ -961,7 +1162,7 @@ Constraint& Constraint::clone() {
   Expression& left = left_.clone();
   Expression& right = right_.clone();
   RelType     type = type_;
-  return *(new Constraint(left,right,type));
+  return *(new Constraint(left,right,type,weight_));
 }
 
 forceinline
@@ -969,7 +1170,7 @@ Constraint& Constraint::cloneToUpdate() {
   Expression& left = left_.cloneToUpdate();
   Expression& right = right_.cloneToUpdate();
   RelType     type = type_;
-  return *(new Constraint(left,right,type));
+  return *(new Constraint(left,right,type,Weight()));
 }
 
 forceinline
@@ -977,7 +1178,7 @@ Constraint& Constraint::cloneWithReplace(Space& home, CPFloatView& source,CPFloa
   Expression& left = left_.cloneWithReplace(home,source,target);
   Expression& right = right_.cloneWithReplace(home,source,target);
   RelType     type = type_;
-  return *(new Constraint(left,right,type));
+  return *(new Constraint(left,right,type,weight_));
 }
 
 
@@ -1005,6 +1206,7 @@ forceinline
 void Constraint::update(Space& home, bool share, Constraint& cnst) {
   left_.update(home,share,cnst.left_);
   right_.update(home,share,cnst.right_);
+  weight_.update(home,share,cnst.weight_);
 }
 
 forceinline
@@ -1030,6 +1232,39 @@ void Constraint::evaluate() {
   right_.evaluate();
 }
 
+forceinline
+INTERVAL Constraint::derivative(const CPFloatView& x) {
+  return subIII(left_.derivative(x),right_.derivative(x));
+}
+
+/**
+ * Until the next call with a null \a xi, evaluate() uses \a xi in place
+ * of the domain of \a x. The interval must outlive the substitution.
+ */
+forceinline
+void Constraint::substitute(const CPFloatView& x, const INTERVAL* xi) {
+  left_.substitute(x,xi);
+  right_.substitute(x,xi);
+}
+
+/// Failure weight, shared with the clones of the constraint
+forceinline
+Weight& Constraint::weight() {
+  return weight_;
+}
+
+/// Record a failure of a propagator of the constraint
+forceinline
+void Constraint::fail() {
+  weight_.fail();
+}
+
+/// Enclosure of left minus right as of the last evaluate()
+forceinline
+INTERVAL Constraint::residual() {
+  return subIII(left_.getInteval(),right_.getInteval());
+}
+
 forceinline
 Gecode::ExecStatus Constraint::propagate(Gecode::Space& home) {
   INTERVAL left = left_.getInteval();
@@ -21,7 +21,7 @@
  */
 
 #include <cpfloat/cpfloat.hh>
-#include <cstdlib>
+#include <cpfloat/branch/viewval.hh>
 
 using Gecode::Home;
 using Gecode::Space;
@@ -33,46 +33,53 @@ using Gecode::ES_OK;
 namespace MPG { namespace CPFloat { namespace Branch {
 
 /**
- * \brief Simple, tuple based brancher
+ * \brief Gap brancher for union variables
  *
- * Simple brancher on a relation variable that selects a tuple and decides
- * to include and exclude it.
+ * Splits the domain of a union variable at its widest gap, so that each
+ * alternative drops the gap without exploring it. Without gaps it splits
+ * at the median.
  */
-class NoneMin : public Gecode::Brancher {
+template <class View>
+class Gap : public Gecode::Brancher {
 protected:
-  CPFloatView x_;
-  /// Simple, tuple-based relation choice
-  class SimpleChoice : public Gecode::Choice {
+  View x_;
+  /// Choice keeping the values around the split
+  class GapChoice : public Gecode::Choice {
   public:
-    /// Tuple to branch on
-    BoundType med_;
+    /// Upper bound of the first alternative
+    BoundType lo_;
+    /// Lower bound of the second alternative
+    BoundType hi_;
     /// Constructor
-    SimpleChoice(const NoneMin& b, BoundType med)
-      : Choice(b,2), med_(med) {}
+    GapChoice(const Gap& b, BoundType lo, BoundType hi)
+      : Choice(b,2), lo_(lo), hi_(hi) {}
     /// Returns the size of the object
     virtual size_t size(void) const {
       return sizeof(*this);
     }
-    virtual void archive(Gecode::Archive&) const {
-      assert(false);
+    /// Archive the exact bounds around the split
+    virtual void archive(Gecode::Archive& e) const {
+      Choice::archive(e);
+      archive_bound(e,lo_);
+      archive_bound(e,hi_);
     }
   };
 public:
   /// Constructor for a brancher on variable \a x
-  NoneMin(Home home, CPFloatView x)
+  Gap(Home home, View x)
     : Brancher(home), x_(x) {}
   /// Brancher posting
-  static void post(Home home, CPFloatView x) {
-    (void) new (home) NoneMin(home,x);
+  static void post(Home home, View x) {
+    (void) new (home) Gap(home,x);
   }
   /// Constructor for clonning
-  NoneMin(Space& home, bool share, NoneMin& b)
+  Gap(Space& home, bool share, Gap& b)
     : Brancher(home,share,b) {
     x_.update(home,share,b.x_);
   }
   /// Brancher copying
   virtual Brancher* copy(Space& home, bool share) {
-    return new (home) NoneMin(home,share,*this);
+    return new (home) Gap(home,share,*this);
   }
   /// Brancher disposal
   virtual size_t dispose(Space& home) {
@@ -81,311 +88,162 @@ public:
   }
   /// Returns the status of the brancher
   virtual bool status(const Space&) const {
-    if (!x_.assigned())
-      return true;
-    return false;
+    return !x_.assigned();
   }
-  /// Creates a choice by selecting a tuple from the unknown of the variable
+  /// Creates a choice splitting at the widest gap
   virtual Choice* choice(Space&) {
-    /// \todo Here we ar finding the median of the interval. The problem is that
-    /// during the commit we are using geq and leq constraints. This in my opinion
-    /// will lead to the exploration of the same subtree twice. Is that right?
-    BoundType m = x_.median();
-    return new SimpleChoice(*this,m);
-  }
-  virtual Choice* choice(const Space&, Gecode::Archive&) {
-    assert(false);
-    return (SimpleChoice*)NULL;
-  }
-  /// Commit choice
-  virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a) {
-    const SimpleChoice& ch = static_cast<const SimpleChoice&>(c);
-    BoundType r = ch.med_;
-    if (a == 0)
-      return Gecode::me_failed(x_.geq(home,r)) ? ES_FAILED : ES_OK;
-    else
-      return Gecode::me_failed(x_.leq(home,r)) ? ES_FAILED : ES_OK;
-  }
-};
-
-/**
- * \brief Size Min, tuple based brancher
- *
- * Custom brancher on a relation variable that selects a tuple and decides
- * to include and exclude it, according to find first unassigned variable with
- * the minimum size.
- */
-class FirstFail : public Gecode::Brancher {
-protected:
-  Gecode::ViewArray<CPFloat::CPFloatView> x_;
-  mutable int start;
-   /// Simple, tuple-based relation choice
-  class PosVal : public Choice {
-  public:
-    int pos_; BoundType val_;
-    PosVal(const FirstFail& b, int p, BoundType v)
-      : Choice(b,2), pos_(p), val_(v) {}
-
-    virtual size_t size(void) const {
-      return sizeof(*this);
+    if (x_.pieces() == 1) {
+      BoundType m = x_.median();
+      return new GapChoice(*this,m,m);
     }
-    virtual void archive(Gecode::Archive& e) const {
-      Choice::archive(e);
-      e << pos_;
-    }
-  };
-public:
-  /// Constructor for a brancher on variable array \a x
-  FirstFail(Home home, Gecode::ViewArray<CPFloat::CPFloatView>& x0)
-    : Brancher(home), x_(x0) {}
-  /// Brancher posting
-  static void post(Home home, Gecode::ViewArray<CPFloat::CPFloatView>& x) {
-    (void) new (home) FirstFail(home,x);
-  }
-  /// Constructor for clonning
-  FirstFail(Space& home, bool share, FirstFail& b)
-    : Brancher(home,share,b) {
-    x_.update(home,share,b.x_);
-  }
-  /// Brancher copying
-  virtual Brancher* copy(Space& home, bool share) {
-    return new (home) FirstFail(home,share,*this);
-  }
-  /// Brancher disposal
-  virtual size_t dispose(Space& home) {
-    (void) Brancher::dispose(home);
-    return sizeof(*this);
-  }
-  /// Returns the status of the brancher
-  virtual bool status(const Space& /*home*/) const {
-    for (int i=0; i<x_.size(); i++)
-      if (!x_[i].assigned()) {
-        start = i;
-        return true;
-      }
-    return false;
-  }
-  /// Creates a choice by selecting a tuple from the unknown of the variable
-  virtual Choice* choice(Space& /*home*/) {
-    int p = start;
-    BoundType s = x_[p].lub()-x_[p].glb();
-    for (int i=start+1; i<x_.size(); i++)
-      if (!x_[i].assigned() && (x_[p].lub()-x_[p].glb())<s) {
-        p = i; s = x_[p].lub()-x_[p].glb();
-      }
-    return new PosVal(*this,p,x_[p].median());
+    int g = 0;
+    for (int i=1; i<x_.pieces()-1; i++)
+      if (x_.lo(i+1)-x_.hi(i) > x_.lo(g+1)-x_.hi(g))
+        g = i;
+    return new GapChoice(*this,x_.hi(g),x_.lo(g+1));
   }
+  /// Creates a choice from the archive \a e
   virtual Choice* choice(const Space&, Gecode::Archive& e) {
-    int pos;
-    e >> pos;
-    return new PosVal(*this, pos, x_[pos].median());
+    BoundType lo = unarchive_bound(e);
+    BoundType hi = unarchive_bound(e);
+    return new GapChoice(*this,lo,hi);
   }
   /// Commit choice
   virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a) {
-    const PosVal& pv = static_cast<const PosVal&>(c);
-    int pos=pv.pos_;
-    BoundType val=pv.val_;
+    const GapChoice& ch = static_cast<const GapChoice&>(c);
     if (a == 0)
-      return Gecode::me_failed(x_[pos].geq(home,val)) ? ES_FAILED : ES_OK;
+      return Gecode::me_failed(x_.leq(home,ch.lo_)) ? ES_FAILED : ES_OK;
     else
-      return Gecode::me_failed(x_[pos].leq(home,val)) ? ES_FAILED : ES_OK;
+      return Gecode::me_failed(x_.geq(home,ch.hi_)) ? ES_FAILED : ES_OK;
   }
 };
 
 /**
- * \brief Naive, tuple based brancher
+ * \brief Brancher on a random unassigned view
  *
- * Custom brancher on a relation variable that selects a tuple and decides
- * to include and exclude it, without improve performance.
+ * The view is drawn by a minimal standard (Park-Miller) generator whose
+ * state belongs to the brancher: it is seeded at posting and copied
+ * with the brancher, so a search is reproducible for a given seed and
+ * threads do not share it. Slicing, commit and archiving are those of
+ * ViewValBrancher.
  */
-class Naive : public Gecode::Brancher {
+template <class View>
+class Rand : public ViewValBrancher<View> {
 protected:
-  Gecode::ViewArray<CPFloat::CPFloatView> x_;
-  mutable int start;
-   /// Simple, tuple-based relation choice
-  class PosVal : public Choice {
-  public:
-    int pos_; BoundType val_;
-    PosVal(const Naive& b, int p, BoundType v)
-      : Choice(b,2), pos_(p), val_(v) {}
-
-    virtual size_t size(void) const {
-      return sizeof(*this);
-    }
-    virtual void archive(Gecode::Archive&) const {
-      assert(false);
-    }
-  };
-public:
-  /// Constructor for a brancher on variable array \a x
-  Naive(Home home, Gecode::ViewArray<CPFloat::CPFloatView>& x0)
-    : Brancher(home), x_(x0) {}
-  /// Brancher posting
-  static void post(Home home, Gecode::ViewArray<CPFloat::CPFloatView>& x) {
-    (void) new (home) Naive(home,x);
-  }
-  /// Constructor for clonning
-  Naive(Space& home, bool share, Naive& b)
-    : Brancher(home,share,b) {
-    x_.update(home,share,b.x_);
+  /// State of the random number generator, in \f$ [1,2^{31}-2] \f$
+  unsigned int seed_;
+  /// Returns a random number in \f$ [0,n) \f$
+  unsigned int rnd(unsigned int n) {
+    seed_ = static_cast<unsigned int>
+      ((static_cast<boost::uint64_t>(seed_) * 16807U) % 2147483647U);
+    return static_cast<unsigned int>
+      ((static_cast<boost::uint64_t>(seed_-1) * n) / 2147483646U);
   }
-  /// Brancher copying
-  virtual Brancher* copy(Space& home, bool share) {
-    return new (home) Naive(home,share,*this);
-  }
-  /// Brancher disposal
-  virtual size_t dispose(Space& home) {
-    (void) Brancher::dispose(home);
-    return sizeof(*this);
-  }
-  /// Returns the status of the brancher
-  virtual bool status(const Space& /*home*/) const {
-    for (int i=0; i<x_.size(); i++)
-      if (!x_[i].assigned()) {
-        start = i;
-        return true;
-      }
-    return false;
-  }
-  /// Creates a choice by selecting a tuple from the unknown of the variable
-  virtual Choice* choice(Space& /*home*/) {
-    for (int i=0; i<x_.size(); i++)
-      if (!x_[i].assigned()) {
-        return new PosVal(*this,i,x_[i].median());
-      }
-    return NULL;
-  }
-  virtual Choice* choice(const Space&, Gecode::Archive&) {
-    assert(false);
-    return (PosVal*)NULL;
-  }
-  /// Commit choice
-  virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a) {
-    const PosVal& pv = static_cast<const PosVal&>(c);
-    int pos=pv.pos_;
-    BoundType val=pv.val_;
-    if (a == 0)
-      return Gecode::me_failed(x_[pos].geq(home,val)) ? ES_FAILED : ES_OK;
-    else
-      return Gecode::me_failed(x_[pos].leq(home,val)) ? ES_FAILED : ES_OK;
-  }
-};
-
-/**
- * \brief Rand, tuple based brancher
- *
- * Custom brancher on a relation variable that selects a tuple and decides
- * to include and exclude it, without improve performance.
- */
-class Rand : public Gecode::Brancher {
-protected:
-  Gecode::ViewArray<CPFloat::CPFloatView> x_;
-  mutable int start;
-   /// Simple, tuple-based relation choice
-  class PosVal : public Choice {
-  public:
-    int pos_; BoundType val_;
-    PosVal(const Rand& b, int p, BoundType v)
-      : Choice(b,2), pos_(p), val_(v) {}
-
-    virtual size_t size(void) const {
-      return sizeof(*this);
-    }
-    virtual void archive(Gecode::Archive&) const {
-      assert(false);
-    }
-  };
 public:
-  /// Constructor for a brancher on variable array \a x
-  Rand(Home home, Gecode::ViewArray<CPFloat::CPFloatView>& x0)
-    : Brancher(home), x_(x0) {}
+  /// Constructor for a brancher on the views \a x
+  Rand(Home home, Gecode::ViewArray<View>& x, unsigned int seed,
+       CPFloatValBranch vals, BoundType ratio, int k)
+    : ViewValBrancher<View>(home,x,tiebreak(CPFLOAT_VAR_NONE,CPFLOAT_VAR_NONE),
+                            vals,ratio,k),
+      seed_((seed % 2147483646U) + 1) {}
   /// Brancher posting
-  static void post(Home home, Gecode::ViewArray<CPFloat::CPFloatView>& x) {
-    (void) new (home) Rand(home,x);
+  static void post(Home home, Gecode::ViewArray<View>& x, unsigned int seed,
+                   CPFloatValBranch vals, BoundType ratio, int k) {
+    (void) new (home) Rand(home,x,seed,vals,ratio,k);
   }
   /// Constructor for clonning
   Rand(Space& home, bool share, Rand& b)
-    : Brancher(home,share,b) {
-    x_.update(home,share,b.x_);
-  }
+    : ViewValBrancher<View>(home,share,b), seed_(b.seed_) {}
   /// Brancher copying
-  virtual Brancher* copy(Space& home, bool share) {
+  virtual Gecode::Brancher* copy(Space& home, bool share) {
     return new (home) Rand(home,share,*this);
   }
   /// Brancher disposal
   virtual size_t dispose(Space& home) {
-    (void) Brancher::dispose(home);
+    (void) ViewValBrancher<View>::dispose(home);
     return sizeof(*this);
   }
-  /// Returns the status of the brancher
-  virtual bool status(const Space& /*home*/) const {
-    for (int i=0; i<x_.size(); i++)
-      if (!x_[i].assigned()) {
-        start = i;
-        return true;
-      }
-    return false;
-  }
-  /// Creates a choice by selecting a tuple from the unknown of the variable
+  /// Creates a choice for a random unassigned view
   virtual Choice* choice(Space& home) {
-    int unassignedCount=0;
-    for (int i=0; i<x_.size(); i++) {
-      if (!x_[i].assigned()) unassignedCount++;
-    }
-    Gecode::ViewArray<CPFloat::CPFloatView> unassignedVars(home,unassignedCount);
-    for (int i=0,r=0; i<x_.size(); i++) {
-      if (!x_[i].assigned()) {
-        unassignedVars[r++] = x_[i];
-      }
-    }
-    int pos = rand() % unassignedCount;
-
-    return new PosVal(*this,pos,unassignedVars[pos].median());
-  }
-  virtual Choice* choice(const Space&, Gecode::Archive&) {
-    assert(false);
-    return (PosVal*)NULL;
-  }
-  /// Commit choice
-  virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a) {
-    const PosVal& pv = static_cast<const PosVal&>(c);
-    int pos=pv.pos_;
-    BoundType val=pv.val_;
-    if (a == 0)
-      return Gecode::me_failed(x_[pos].geq(home,val)) ? ES_FAILED : ES_OK;
-    else
-      return Gecode::me_failed(x_[pos].leq(home,val)) ? ES_FAILED : ES_OK;
+    unsigned int n = 0;
+    for (int i=this->start_; i<this->x_.size(); i++)
+      if (!this->x_[i].assigned())
+        n++;
+    unsigned int r = rnd(n);
+    int p = this->start_;
+    for (;; p++)
+      if (!this->x_[p].assigned() && (r-- == 0))
+        break;
+    this->last_ = p;
+    return this->slice(home,p);
   }
 };
 
 }}
 
-void branch(Home home, CPFloatVar x) {
+template <class B, class P>
+void branch(Home home, const CPFloatVarArgsT<B,P>& x,
+            const CPFloat::CPFloatVarTieBreak& vars, CPFloat::CPFloatValBranch vals,
+            CPFloat::BoundType ratio, int k) {
   using namespace CPFloat::Branch;
+  if ((vars.a >= CPFloat::CPFLOAT_VAR_SMEAR_SUM) ||
+      (vars.b >= CPFloat::CPFLOAT_VAR_SMEAR_SUM))
+    throw CPFloat::UnknownBranching("CPFloat::branch");
+  if (k < 2)
+    throw CPFloat::OutOfLimits("CPFloat::branch");
   if (home.failed()) return;
-  NoneMin::post(home,x);
+  Gecode::ViewArray<CPFloat::CPFloatViewT<B,P> > y(home,x);
+  ViewValBrancher<CPFloat::CPFloatViewT<B,P> >::post(home,y,vars,vals,ratio,k);
 }
 
-void firstfail(Home home, const CPFloatVarArgs& x) {
-  using namespace CPFloat::Branch;
-  if (home.failed()) return;
-  Gecode::ViewArray<CPFloat::CPFloatView> y(home,x);
-  FirstFail::post(home,y);
+template <class B, class P>
+void branch(Home home, CPFloatVarT<B,P> x) {
+  CPFloatVarArgsT<B,P> y(1);
+  y[0] = x;
+  branch(home,y,CPFloat::CPFLOAT_VAR_NONE,CPFloat::CPFLOAT_VAL_SPLIT_MAX);
 }
 
-void naive(Home home, const CPFloatVarArgs& x) {
+template <class B, class P>
+void branch(Home home, CPFloatUnionVarT<B,P> x) {
   using namespace CPFloat::Branch;
   if (home.failed()) return;
-  Gecode::ViewArray<CPFloat::CPFloatView> y(home,x);
-  Naive::post(home,y);
+  Gap<CPFloat::CPFloatUnionViewT<B,P> >::post(home,x);
 }
 
-void randselection(Home home, const CPFloatVarArgs& x) {
+template <class B, class P>
+void firstfail(Home home, const CPFloatVarArgsT<B,P>& x) {
+  branch(home,x,CPFloat::CPFLOAT_VAR_SIZE_MIN,CPFloat::CPFLOAT_VAL_SPLIT_MAX);
+}
+
+template <class B, class P>
+void naive(Home home, const CPFloatVarArgsT<B,P>& x) {
+  branch(home,x,CPFloat::CPFLOAT_VAR_NONE,CPFloat::CPFLOAT_VAL_SPLIT_MAX);
+}
+
+template <class B, class P>
+void randselection(Home home, const CPFloatVarArgsT<B,P>& x, unsigned int seed,
+                   CPFloat::CPFloatValBranch vals, CPFloat::BoundType ratio,
+                   int k) {
   using namespace CPFloat::Branch;
+  if (k < 2)
+    throw CPFloat::OutOfLimits("CPFloat::randselection");
   if (home.failed()) return;
-  Gecode::ViewArray<CPFloat::CPFloatView> y(home,x);
-  Rand::post(home,y);
+  Gecode::ViewArray<CPFloat::CPFloatViewT<B,P> > y(home,x);
+  Rand<CPFloat::CPFloatViewT<B,P> >::post(home,y,seed,vals,ratio,k);
 }
 
-}
+using namespace CPFloat;
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void branch(Home, const CPFloatVarArgsT<B,P >&, \
+                       const CPFloatVarTieBreak&, CPFloatValBranch, BoundType, \
+                       int); \
+  template void branch(Home, CPFloatVarT<B,P >); \
+  template void branch(Home, CPFloatUnionVarT<B,P >); \
+  template void firstfail(Home, const CPFloatVarArgsT<B,P >&); \
+  template void naive(Home, const CPFloatVarArgsT<B,P >&); \
+  template void randselection(Home, const CPFloatVarArgsT<B,P >&, unsigned int, \
+                              CPFloatValBranch, BoundType, int);
+CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
 
+}
@@ -86,11 +86,9 @@ public:
 
     narrow_acos(&x,&y);
 
-    GECODE_ME_CHECK(left_.leq(home,x.hi));
-    GECODE_ME_CHECK(left_.geq(home,x.lo));
+    GECODE_ME_CHECK(left_.narrow(home,x.lo,x.hi));
 
-    GECODE_ME_CHECK(right_.leq(home,y.hi));
-    GECODE_ME_CHECK(right_.geq(home,y.lo));
+    GECODE_ME_CHECK(right_.narrow(home,y.lo,y.hi));
 
     // Propagator subsumpiton
     if (left_.assigned() && right_.assigned())
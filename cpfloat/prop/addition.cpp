@@ -21,16 +21,34 @@
  */
 
 #include <cpfloat/prop/addition.hh>
+#include <cpfloat/prop/equality.hh>
 
 namespace MPG {
   using namespace CPFloat;
   using namespace CPFloat::Prop;
-  void addition(Gecode::Space& home, CPFloatVar x, CPFloatVar y, CPFloatVar z) {
+  template <class B, class P>
+  void addition(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z) {
     if (home.failed()) return;
     
-    CPFloatView left1(x);
-    CPFloatView left2(y);
-    CPFloatView right(z);
-    GECODE_ES_FAIL((Addition<CPFloatView,CPFloatView,CPFloatView>::post(home,left1,left2,right)));
+    CPFloatViewT<B,P> left1(x);
+    CPFloatViewT<B,P> left2(y);
+    CPFloatViewT<B,P> right(z);
+    GECODE_ES_FAIL((Addition<CPFloatViewT<B,P>,CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left1,left2,right)));
   }  
+
+  template <class B, class P>
+  void addition(Gecode::Space& home, CPFloatVarT<B,P> x, BoundType c, CPFloatVarT<B,P> z) {
+    if (home.failed()) return;
+
+    CPFloatViewT<B,P> vx(x);
+    OffsetView<CPFloatViewT<B,P> > left(vx,c);
+    CPFloatViewT<B,P> right(z);
+    GECODE_ES_FAIL((Equality<OffsetView<CPFloatViewT<B,P> >,CPFloatViewT<B,P> >::post(home,left,right)));
+  }
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void addition(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >, CPFloatVarT<B,P >); \
+  template void addition(Gecode::Space&, CPFloatVarT<B,P >, BoundType, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
 }
@@ -93,14 +93,11 @@ public:
 
     narrow_add(&x,&y,&z);
 
-    GECODE_ME_CHECK(left1_.leq(home,x.hi));
-    GECODE_ME_CHECK(left1_.geq(home,x.lo));
+    GECODE_ME_CHECK(left1_.narrow(home,x.lo,x.hi));
 
-    GECODE_ME_CHECK(left2_.leq(home,y.hi));
-    GECODE_ME_CHECK(left2_.geq(home,y.lo));
+    GECODE_ME_CHECK(left2_.narrow(home,y.lo,y.hi));
 
-    GECODE_ME_CHECK(right_.leq(home,z.hi));
-    GECODE_ME_CHECK(right_.geq(home,z.lo));
+    GECODE_ME_CHECK(right_.narrow(home,z.lo,z.hi));
 
     // Propagator subsumpiton
     if (left1_.assigned() && left2_.assigned() && right_.assigned())
@@ -25,11 +25,17 @@
 namespace MPG {
   using namespace CPFloat;
   using namespace CPFloat::Prop;
-  void asin(Gecode::Space& home, CPFloatVar x, CPFloatVar y) {
+  template <class B, class P>
+  void asin(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y) {
     if (home.failed()) return;
     
-    CPFloatView left(x);
-    CPFloatView right(y);
-    GECODE_ES_FAIL((Asin<CPFloatView,CPFloatView>::post(home,left,right)));
+    CPFloatViewT<B,P> left(x);
+    CPFloatViewT<B,P> right(y);
+    GECODE_ES_FAIL((Asin<CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left,right)));
   }  
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void asin(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
 }
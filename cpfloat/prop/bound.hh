@@ -0,0 +1,102 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_PROP_BOUND_HH__
+#define __CPFLOAT_PROP_BOUND_HH__
+
+#include <cpfloat/cpfloat.hh>
+#include <cpfloat/search/incumbent.hh>
+
+namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Propagates: \f$ f \leq \f$ next_bound() of the shared incumbent
+ *
+ * Runs whenever one of the views \a x (the decision variables) changes,
+ * so every node of the search, including the nodes stolen by another
+ * worker or recomputed, is pruned against the best bound found by any
+ * worker so far.
+ * \ingroup SetProp
+ */
+template <typename View>
+class Bound : public Gecode::Propagator {
+protected:
+  /// Decision variables
+  Gecode::ViewArray<View> x_;
+  /// Objective
+  View f_;
+  /// Shared upper bound, one reference per propagator
+  Incumbent* inc_;
+  /// Absolute tolerance
+  BoundType a_;
+  /// Relative tolerance
+  BoundType r_;
+public:
+  /// Constructor for the propagator \f$ f \leq next\_bound(inc) \f$
+  Bound(Gecode::Home home, Gecode::ViewArray<View>& x, View f,
+        Incumbent* inc, BoundType a, BoundType r)
+    : Gecode::Propagator(home), x_(x), f_(f), inc_(inc->share()),
+      a_(a), r_(r) {
+    x_.subscribe(home,*this,CPFloat::PC_CPFLOAT_BND);
+    home.notice(*this,Gecode::AP_DISPOSE);
+  }
+  /// Propagator posting
+  static Gecode::ExecStatus post(Gecode::Home home, Gecode::ViewArray<View>& x,
+                                 View f, Incumbent* inc,
+                                 BoundType a, BoundType r) {
+    (void) new (home) Bound(home,x,f,inc,a,r);
+    return Gecode::ES_OK;
+  }
+  /// Propagator disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    home.ignore(*this,Gecode::AP_DISPOSE);
+    x_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    inc_->release();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+  /// Copy constructor
+  Bound(Gecode::Space& home, bool share, Bound& p)
+    : Gecode::Propagator(home,share,p), inc_(p.inc_->share()),
+      a_(p.a_), r_(p.r_) {
+    x_.update(home,share,p.x_);
+    f_.update(home,share,p.f_);
+  }
+  /// Copy
+  virtual Gecode::Propagator* copy(Gecode::Space& home, bool share) {
+    return new (home) Bound(home,share,*this);
+  }
+  /// Cost
+  virtual Gecode::PropCost cost(const Gecode::Space&,
+                                const Gecode::ModEventDelta&) const {
+    return Gecode::PropCost::unary(Gecode::PropCost::LO);
+  }
+  /// Main propagation algorithm
+  virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                       const Gecode::ModEventDelta&) {
+    BoundType u = next_bound(inc_->get(),a_,r_);
+    if (u < std::numeric_limits<BoundType>::infinity())
+      GECODE_ME_CHECK(f_.leq(home,u));
+    return Gecode::ES_FIX;
+  }
+};
+}}}
+#endif
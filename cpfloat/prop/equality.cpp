@@ -25,11 +25,48 @@
 namespace MPG {
   using namespace CPFloat;
   using namespace CPFloat::Prop;
-  void equality(Gecode::Space& home, CPFloatVar x, CPFloatVar y) {
+  template <class B, class P>
+  void equality(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y) {
     if (home.failed()) return;
 
-    CPFloatView left(x);
-    CPFloatView right(y);
-    GECODE_ES_FAIL((Equality<CPFloatView,CPFloatView>::post(home,left,right)));
+    CPFloatViewT<B,P> left(x);
+    CPFloatViewT<B,P> right(y);
+    GECODE_ES_FAIL((Equality<CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left,right)));
   }
+
+  template <class B, class P>
+  void equality(Gecode::Space& home, CPFloatUnionVarT<B,P> x, CPFloatVarT<B,P> y) {
+    if (home.failed()) return;
+
+    CPFloatUnionViewT<B,P> left(x);
+    CPFloatViewT<B,P> right(y);
+    GECODE_ES_FAIL((Equality<CPFloatUnionViewT<B,P>,CPFloatViewT<B,P> >::post(home,left,right)));
+  }
+
+  template <class B, class P>
+  void equality(Gecode::Space& home, CPFloatVarT<B,P> x, BoundType c) {
+    if (home.failed()) return;
+
+    CPFloatViewT<B,P> left(x);
+    ConstCPFloatView right(c);
+    GECODE_ES_FAIL((Equality<CPFloatViewT<B,P>,ConstCPFloatView>::post(home,left,right)));
+  }
+
+  template <class B, class P>
+  void negation(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y) {
+    if (home.failed()) return;
+
+    CPFloatViewT<B,P> vx(x);
+    MinusView<CPFloatViewT<B,P> > left(vx);
+    CPFloatViewT<B,P> right(y);
+    GECODE_ES_FAIL((Equality<MinusView<CPFloatViewT<B,P> >,CPFloatViewT<B,P> >::post(home,left,right)));
+  }
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void equality(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >); \
+  template void equality(Gecode::Space&, CPFloatUnionVarT<B,P >, CPFloatVarT<B,P >); \
+  template void equality(Gecode::Space&, CPFloatVarT<B,P >, BoundType); \
+  template void negation(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
 }
@@ -0,0 +1,51 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cpfloat/prop/exp.hh>
+
+namespace MPG {
+  using namespace CPFloat;
+  using namespace CPFloat::Prop;
+  template <class B, class P>
+  void exp(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y) {
+    if (home.failed()) return;
+    
+    CPFloatViewT<B,P> left(x);
+    CPFloatViewT<B,P> right(y);
+    GECODE_ES_FAIL((Exp<CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left,right)));
+  }  
+  template <class B, class P>
+  void log(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y) {
+    if (home.failed()) return;
+
+    // y = log(x) is posted as x = exp(y)
+    CPFloatViewT<B,P> left(y);
+    CPFloatViewT<B,P> right(x);
+    GECODE_ES_FAIL((Exp<CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left,right)));
+  }
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void exp(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >); \
+  template void log(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
+}
@@ -0,0 +1,102 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_PROP_EXP_HH__
+#define __CPFLOAT_PROP_EXP_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Propagates: \f$ y = exp(x) \f$
+ * \ingroup SetProp
+ */
+template <typename ViewLeft, typename ViewRight>
+class Exp : public Gecode::Propagator {
+protected:
+  /// Left relation of the contraint
+  ViewLeft left_;
+  /// Right relation of the constraint
+  ViewRight right_;
+public:
+  /// Constructor for the propagator \f$ exp(left,right) \f$
+  Exp(Gecode::Home home, ViewLeft left, ViewRight right)
+    : Gecode::Propagator(home), left_(left), right_(right) {
+    left_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
+    right_.subscribe(home,*this,CPFloat::PC_CPFLOAT_BND);
+  }
+  /// Propagator posting
+  static Gecode::ExecStatus post(Gecode::Home home,
+                                 ViewLeft left, ViewRight right) {
+    /// \todo Can we do some processing here and decide to not to post
+    /// the constraint?
+    (void) new (home) Exp(home,left,right);
+    return Gecode::ES_OK;
+  }
+  /// Propagator disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    left_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    right_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+  /// Copy constructor
+  Exp(Gecode::Space& home, bool share, Exp& p)
+    : Gecode::Propagator(home,share,p) {
+    left_.update(home,share,p.left_);
+    right_.update(home,share,p.right_);
+  }
+  /// Copy
+  virtual Gecode::Propagator* copy(Gecode::Space& home, bool share) {
+    return new (home) Exp(home,share,*this);
+  }
+  /// Cost
+  virtual Gecode::PropCost cost(const Gecode::Space&,
+                                const Gecode::ModEventDelta&) const {
+    return Gecode::PropCost::binary(Gecode::PropCost::LO);
+  }
+  /// Main propagation algorithm
+  virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                       const Gecode::ModEventDelta&)  {
+
+    INTERVAL x,y;
+    x.lo = left_.glb();
+    x.hi = left_.lub();
+    y.lo = right_.glb();
+    y.hi = right_.lub();
+
+    if (!narrow_exp(&x,&y))
+      return Gecode::ES_FAILED;
+
+    GECODE_ME_CHECK(left_.narrow(home,x.lo,x.hi));
+
+    GECODE_ME_CHECK(right_.narrow(home,y.lo,y.hi));
+
+    // Propagator subsumpiton
+    if (left_.assigned() && right_.assigned())
+      return home.ES_SUBSUMED(*this);
+
+    return Gecode::ES_FIX;
+  }
+};
+}}}
+#endif
@@ -73,7 +73,10 @@ public:
   virtual Gecode::ExecStatus propagate(Gecode::Space& home,
                                        const Gecode::ModEventDelta&)  {
     cst_.evaluate();
-    GECODE_ME_CHECK(cst_.propagate(home));
+    if (Gecode::me_failed(cst_.propagate(home))) {
+      cst_.fail();
+      return Gecode::ES_FAILED;
+    }
     if (cst_.assigned()) return home.ES_SUBSUMED(*this);
 
     return Gecode::ES_NOFIX;
@@ -77,10 +77,12 @@ public:
     ViewArray<CPFloatView> views(home, cst_.countViews());
     cst_.collectViews(views);
     views.unique(home);
-    for (int i=0; i<views.size(); i++) {
-      lnar(home,views[i],0.05);
-      rnar(home,views[i],0.05);
-    }
+    for (int i=0; i<views.size(); i++)
+      if ((lnar(home,views[i],0.05) == Gecode::ES_FAILED) ||
+          (rnar(home,views[i],0.05) == Gecode::ES_FAILED)) {
+        cst_.fail();
+        return Gecode::ES_FAILED;
+      }
     return Gecode::ES_NOFIX;
   }
 
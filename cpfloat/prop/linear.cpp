@@ -0,0 +1,62 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cpfloat/prop/linear.hh>
+
+namespace MPG {
+  using namespace CPFloat;
+  using namespace CPFloat::Prop;
+  template <class B, class P>
+  void linear(Gecode::Space& home, const CPFloatArgs& a, const CPFloatVarArgsT<B,P>& x,
+              CPFloatRelType r, BoundType c) {
+    if (a.size() != x.size())
+      throw ArgumentSizeMismatch("CPFloat::linear");
+    if (home.failed()) return;
+
+    // terms with a zero coefficient do not take part
+    int n = 0;
+    for (int i=0; i<a.size(); i++)
+      if (a[i] != 0.0) n++;
+    Gecode::ViewArray<CPFloatViewT<B,P> > v(home,n);
+    BoundType* va = home.alloc<BoundType>(n);
+    for (int i=0, j=0; i<a.size(); i++)
+      if (a[i] != 0.0) {
+        v[j] = CPFloatViewT<B,P>(x[i]);
+        va[j] = a[i];
+        j++;
+      }
+
+    BoundType l = c;
+    BoundType u = c;
+    if (r == CPFLOAT_RT_LQ)
+      l = -std::numeric_limits<BoundType>::infinity();
+    else if (r == CPFLOAT_RT_GQ)
+      u = std::numeric_limits<BoundType>::infinity();
+    GECODE_ES_FAIL((Linear<CPFloatViewT<B,P> >::post(home,v,va,l,u)));
+  }  
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void linear(Gecode::Space&, const CPFloatArgs&, const CPFloatVarArgsT<B,P >&, \
+                       CPFloatRelType, BoundType);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
+}
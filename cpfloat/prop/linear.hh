@@ -0,0 +1,181 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_PROP_LINEAR_HH__
+#define __CPFLOAT_PROP_LINEAR_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Propagates: \f$ l \leq \sum_{i} a_i x_i \leq u \f$
+ *
+ * Bounds consistency in two passes over the terms: prefix and suffix
+ * sums of the term bounds give, for every \f$ i \f$, the bounds of the
+ * sum of the other terms without subtracting rounded values. All
+ * the sums are rounded outwards. Views that become assigned are folded
+ * into \f$ [l,u] \f$ and dropped, so later runs only visit the open
+ * terms.
+ *
+ * Inequalities use an infinite \a l or \a u.
+ * \ingroup SetProp
+ */
+template <typename View>
+class Linear : public Gecode::Propagator {
+protected:
+  /// Variables of the constraint
+  Gecode::ViewArray<View> x_;
+  /// Coefficients of the variables, none of them is zero
+  BoundType* a_;
+  /// Lower bound of the right hand side
+  BoundType l_;
+  /// Upper bound of the right hand side
+  BoundType u_;
+public:
+  /// Constructor for the propagator \f$ l \leq \sum_{i} a_i x_i \leq u \f$
+  Linear(Gecode::Home home, Gecode::ViewArray<View>& x, BoundType* a,
+         BoundType l, BoundType u)
+    : Gecode::Propagator(home), x_(x), a_(a), l_(l), u_(u) {
+    x_.subscribe(home,*this,CPFloat::PC_CPFLOAT_BND);
+  }
+  /// Propagator posting
+  static Gecode::ExecStatus post(Gecode::Home home, Gecode::ViewArray<View>& x,
+                                 BoundType* a, BoundType l, BoundType u) {
+    if (x.size() == 0)
+      return (l <= 0.0 && 0.0 <= u) ? Gecode::ES_OK : Gecode::ES_FAILED;
+    (void) new (home) Linear(home,x,a,l,u);
+    return Gecode::ES_OK;
+  }
+  /// Propagator disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    x_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+  /// Copy constructor
+  Linear(Gecode::Space& home, bool share, Linear& p)
+    : Gecode::Propagator(home,share,p), l_(p.l_), u_(p.u_) {
+    x_.update(home,share,p.x_);
+    a_ = home.alloc<BoundType>(x_.size());
+    for (int i=0; i<x_.size(); i++)
+      a_[i] = p.a_[i];
+  }
+  /// Copy
+  virtual Gecode::Propagator* copy(Gecode::Space& home, bool share) {
+    return new (home) Linear(home,share,*this);
+  }
+  /// Cost
+  virtual Gecode::PropCost cost(const Gecode::Space&,
+                                const Gecode::ModEventDelta&) const {
+    return Gecode::PropCost::linear(Gecode::PropCost::LO,x_.size());
+  }
+  /// Main propagation algorithm
+  virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                       const Gecode::ModEventDelta&)  {
+    int n = x_.size();
+    Gecode::Region r(home);
+    // bounds of the terms, prefix sums (p) and suffix sums (s)
+    BoundType* tl = r.alloc<BoundType>(n);
+    BoundType* tu = r.alloc<BoundType>(n);
+    BoundType* pl = r.alloc<BoundType>(n+1);
+    BoundType* pu = r.alloc<BoundType>(n+1);
+    BoundType* sl = r.alloc<BoundType>(n+1);
+    BoundType* su = r.alloc<BoundType>(n+1);
+    {
+      boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+
+      // fold the assigned views into the right hand side
+      for (int i=0; i<n; ) {
+        if (x_[i].assigned()) {
+          if (a_[i] > 0.0) {
+            l_ = rnd.sub_down(l_,rnd.mul_up(a_[i],x_[i].lub()));
+            u_ = rnd.sub_up(u_,rnd.mul_down(a_[i],x_[i].glb()));
+          } else {
+            l_ = rnd.sub_down(l_,rnd.mul_up(a_[i],x_[i].glb()));
+            u_ = rnd.sub_up(u_,rnd.mul_down(a_[i],x_[i].lub()));
+          }
+          x_[i].cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+          n--;
+          x_[i] = x_[n];
+          a_[i] = a_[n];
+        } else {
+          i++;
+        }
+      }
+      x_.size(n);
+
+      for (int i=0; i<n; i++)
+        if (a_[i] > 0.0) {
+          tl[i] = rnd.mul_down(a_[i],x_[i].glb());
+          tu[i] = rnd.mul_up(a_[i],x_[i].lub());
+        } else {
+          tl[i] = rnd.mul_down(a_[i],x_[i].lub());
+          tu[i] = rnd.mul_up(a_[i],x_[i].glb());
+        }
+      pl[0] = pu[0] = 0.0;
+      for (int i=0; i<n; i++) {
+        pl[i+1] = rnd.add_down(pl[i],tl[i]);
+        pu[i+1] = rnd.add_up(pu[i],tu[i]);
+      }
+      sl[n] = su[n] = 0.0;
+      for (int i=n; i--; ) {
+        sl[i] = rnd.add_down(sl[i+1],tl[i]);
+        su[i] = rnd.add_up(su[i+1],tu[i]);
+      }
+
+      if (pu[n] < l_ || pl[n] > u_)
+        return Gecode::ES_FAILED;
+      // Propagator subsumpiton
+      if (l_ <= pl[n] && pu[n] <= u_)
+        return home.ES_SUBSUMED(*this);
+
+      // new bounds of the views, the terms are overwritten
+      for (int i=0; i<n; i++) {
+        BoundType lo = rnd.sub_down(l_,rnd.add_up(pu[i],su[i+1]));
+        BoundType hi = rnd.sub_up(u_,rnd.add_down(pl[i],sl[i+1]));
+        // inf - inf: the other terms do not bound this one
+        if (lo != lo) lo = -std::numeric_limits<BoundType>::infinity();
+        if (hi != hi) hi = std::numeric_limits<BoundType>::infinity();
+        if (a_[i] > 0.0) {
+          tl[i] = rnd.div_down(lo,a_[i]);
+          tu[i] = rnd.div_up(hi,a_[i]);
+        } else {
+          tl[i] = rnd.div_down(hi,a_[i]);
+          tu[i] = rnd.div_up(lo,a_[i]);
+        }
+      }
+    }
+
+    bool modified = false;
+    for (int i=0; i<n; i++) {
+      Gecode::ModEvent me = x_[i].narrow(home,tl[i],tu[i]);
+      if (Gecode::me_failed(me))
+        return Gecode::ES_FAILED;
+      modified |= Gecode::me_modified(me);
+    }
+
+    // narrowing one term loosens the sums used by the others
+    return modified ? Gecode::ES_NOFIX : Gecode::ES_FIX;
+  }
+};
+}}}
+#endif
@@ -0,0 +1,42 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cpfloat/prop/min.hh>
+
+namespace MPG {
+  using namespace CPFloat;
+  using namespace CPFloat::Prop;
+  template <class B, class P>
+  void min(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z) {
+    if (home.failed()) return;
+    
+    CPFloatViewT<B,P> left1(x);
+    CPFloatViewT<B,P> left2(y);
+    CPFloatViewT<B,P> right(z);
+    GECODE_ES_FAIL((Min<CPFloatViewT<B,P>,CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left1,left2,right)));
+  }  
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void min(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
+}
@@ -0,0 +1,75 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cpfloat/prop/polynomial.hh>
+
+namespace MPG {
+  using namespace CPFloat;
+  using namespace CPFloat::Prop;
+  template <class B, class P>
+  void polynomial(Gecode::Space& home, const CPFloatArgs& c, const CPFloatIntArgs& e,
+                  const CPFloatVarArgsT<B,P>& x, CPFloatRelType r, BoundType rhs) {
+    int n = x.size();
+    if (e.size() != c.size()*n)
+      throw ArgumentSizeMismatch("CPFloat::polynomial");
+    for (int i=0; i<e.size(); i++)
+      if (e[i] < 0)
+        throw OutOfLimits("CPFloat::polynomial");
+    if (home.failed()) return;
+
+    BoundType l = rhs;
+    BoundType u = rhs;
+    if (r == CPFLOAT_RT_LQ)
+      l = -std::numeric_limits<BoundType>::infinity();
+    else if (r == CPFLOAT_RT_GQ)
+      u = std::numeric_limits<BoundType>::infinity();
+
+    // monomials with a zero coefficient do not take part
+    int m = 0;
+    for (int k=0; k<c.size(); k++)
+      if (c[k] != 0.0) m++;
+    if (m == 0) {
+      if (!(l <= 0.0 && 0.0 <= u))
+        home.fail();
+      return;
+    }
+    Gecode::ViewArray<CPFloatViewT<B,P> > v(home,n);
+    for (int i=0; i<n; i++)
+      v[i] = CPFloatViewT<B,P>(x[i]);
+    BoundType* vc = home.alloc<BoundType>(m);
+    int* ve = home.alloc<int>(m*n);
+    for (int k=0, j=0; k<c.size(); k++)
+      if (c[k] != 0.0) {
+        vc[j] = c[k];
+        for (int i=0; i<n; i++)
+          ve[j*n+i] = e[k*n+i];
+        j++;
+      }
+    GECODE_ES_FAIL((Polynomial<CPFloatViewT<B,P> >::post(home,v,m,vc,ve,l,u)));
+  }  
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void polynomial(Gecode::Space&, const CPFloatArgs&, const CPFloatIntArgs&, \
+                           const CPFloatVarArgsT<B,P >&, CPFloatRelType, BoundType);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
+}
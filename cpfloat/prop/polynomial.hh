@@ -0,0 +1,207 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_PROP_POLYNOMIAL_HH__
+#define __CPFLOAT_PROP_POLYNOMIAL_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Propagates: \f$ l \leq \sum_{k} c_k \prod_{i} x_i^{e_{ki}} \leq u \f$
+ *
+ * For every variable \f$ x_j \f$ the polynomial is read as a univariate
+ * polynomial \f$ \sum_{d} q_d x_j^d \f$ whose interval coefficients
+ * \f$ q_d \f$ come from the other variables. Prefix and suffix products
+ * of the powers inside each monomial give all the \f$ q_d \f$ in
+ * \f$ O(mn) \f$. The polynomial is enclosed with a Horner scheme over
+ * the degrees of \f$ x_j \f$, and every degree \f$ d \f$ is projected
+ * back through \f$ x_j^d \f$. Powers always go through pow_intII and
+ * narrow_pow_int, so even powers never straddle zero.
+ *
+ * Inequalities use an infinite \a l or \a u.
+ * \ingroup SetProp
+ */
+template <typename View>
+class Polynomial : public Gecode::Propagator {
+protected:
+  /// Variables of the constraint
+  Gecode::ViewArray<View> x_;
+  /// Number of monomials
+  int m_;
+  /// Coefficients of the monomials
+  BoundType* c_;
+  /// Exponents, \f$ e_{ki} \f$ is stored at \f$ k \cdot n + i \f$
+  int* e_;
+  /// Lower bound of the right hand side
+  BoundType l_;
+  /// Upper bound of the right hand side
+  BoundType u_;
+public:
+  /// Constructor for the propagator \f$ l \leq \sum_{k} c_k \prod_{i} x_i^{e_{ki}} \leq u \f$
+  Polynomial(Gecode::Home home, Gecode::ViewArray<View>& x, int m,
+             BoundType* c, int* e, BoundType l, BoundType u)
+    : Gecode::Propagator(home), x_(x), m_(m), c_(c), e_(e), l_(l), u_(u) {
+    x_.subscribe(home,*this,CPFloat::PC_CPFLOAT_BND);
+  }
+  /// Propagator posting
+  static Gecode::ExecStatus post(Gecode::Home home, Gecode::ViewArray<View>& x,
+                                 int m, BoundType* c, int* e,
+                                 BoundType l, BoundType u) {
+    (void) new (home) Polynomial(home,x,m,c,e,l,u);
+    return Gecode::ES_OK;
+  }
+  /// Propagator disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    x_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+  /// Copy constructor
+  Polynomial(Gecode::Space& home, bool share, Polynomial& p)
+    : Gecode::Propagator(home,share,p), m_(p.m_), l_(p.l_), u_(p.u_) {
+    x_.update(home,share,p.x_);
+    int n = x_.size();
+    c_ = home.alloc<BoundType>(m_);
+    e_ = home.alloc<int>(m_*n);
+    for (int k=0; k<m_; k++)
+      c_[k] = p.c_[k];
+    for (int k=0; k<m_*n; k++)
+      e_[k] = p.e_[k];
+  }
+  /// Copy
+  virtual Gecode::Propagator* copy(Gecode::Space& home, bool share) {
+    return new (home) Polynomial(home,share,*this);
+  }
+  /// Cost
+  virtual Gecode::PropCost cost(const Gecode::Space&,
+                                const Gecode::ModEventDelta&) const {
+    return Gecode::PropCost::quadratic(Gecode::PropCost::LO,m_*x_.size());
+  }
+  /// Main propagation algorithm
+  virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                       const Gecode::ModEventDelta&)  {
+    int n = x_.size();
+    Gecode::Region r(home);
+
+    // prefix (pre) and suffix (suf) products of the powers in every monomial
+    INTERVAL* pre = r.alloc<INTERVAL>(m_*(n+1));
+    INTERVAL* suf = r.alloc<INTERVAL>(m_*(n+1));
+    int dmax = 0;
+    for (int k=0; k<m_; k++) {
+      INTERVAL* p = pre + k*(n+1);
+      INTERVAL* s = suf + k*(n+1);
+      const int* e = e_ + k*n;
+      p[0] = cnstDI(c_[k]);
+      for (int i=0; i<n; i++)
+        p[i+1] = (e[i] == 0) ? p[i] : mulIII(p[i],pow_intII(box(i),e[i]));
+      s[n] = cnstDI(1.0);
+      for (int i=n; i--; ) {
+        s[i] = (e[i] == 0) ? s[i+1] : mulIII(s[i+1],pow_intII(box(i),e[i]));
+        dmax = std::max(dmax,e[i]);
+      }
+    }
+
+    INTERVAL t = makeDDI(l_,u_);
+    if (dmax == 0) {
+      // no variable occurs: only the sum of the coefficients is left
+      INTERVAL h = cnstDI(0.0);
+      for (int k=0; k<m_; k++)
+        h = addIII(h,pre[k*(n+1)+n]);
+      if (h.hi < t.lo || h.lo > t.hi)
+        return Gecode::ES_FAILED;
+      return home.ES_SUBSUMED(*this);
+    }
+
+    // coefficients of the univariate polynomial and which degrees occur
+    INTERVAL* q = r.alloc<INTERVAL>(dmax+1);
+    bool* occurs = r.alloc<bool>(dmax+1);
+    bool modified = false;
+    bool entailed = false;
+
+    for (int j=0; j<n; j++) {
+      for (int d=0; d<=dmax; d++) {
+        q[d] = cnstDI(0.0);
+        occurs[d] = false;
+      }
+      int dj = 0;
+      for (int k=0; k<m_; k++) {
+        int d = e_[k*n+j];
+        q[d] = addIII(q[d],mulIII(pre[k*(n+1)+j],suf[k*(n+1)+j+1]));
+        occurs[d] = true;
+        dj = std::max(dj,d);
+      }
+      if (dj == 0)
+        continue;
+
+      INTERVAL xj = box(j);
+      // Horner scheme over the occurring degrees
+      INTERVAL h = q[dj];
+      int last = dj;
+      for (int d=dj; d--; )
+        if (occurs[d]) {
+          h = addIII(mulIII(h,pow_intII(xj,last-d)),q[d]);
+          last = d;
+        }
+      h = mulIII(h,pow_intII(xj,last));
+      if (h.hi < t.lo || h.lo > t.hi)
+        return Gecode::ES_FAILED;
+      if (t.lo <= h.lo && h.hi <= t.hi) {
+        entailed = true;
+        break;
+      }
+
+      for (int d=1; d<=dj; d++) {
+        if (!occurs[d])
+          continue;
+        // q_d * x_j^d = t - sum of the other degrees
+        INTERVAL o = occurs[0] ? q[0] : cnstDI(0.0);
+        for (int b=1; b<=dj; b++)
+          if (occurs[b] && b != d)
+            o = addIII(o,mulIII(q[b],pow_intII(xj,b)));
+        INTERVAL y = pow_intII(xj,d);
+        if (!intersect_divIII(subIII(t,o),q[d],&y))
+          return Gecode::ES_FAILED;
+        if (!narrow_pow_int(&xj,d,&y))
+          return Gecode::ES_FAILED;
+      }
+      Gecode::ModEvent me = x_[j].narrow(home,xj.lo,xj.hi);
+      if (Gecode::me_failed(me))
+        return Gecode::ES_FAILED;
+      modified |= Gecode::me_modified(me);
+    }
+
+    // Propagator subsumpiton
+    if (entailed || x_.assigned())
+      return home.ES_SUBSUMED(*this);
+
+    // a narrowed variable loosens the coefficients used for the others
+    return modified ? Gecode::ES_NOFIX : Gecode::ES_FIX;
+  }
+private:
+  /// Current domain of the \a i-th variable
+  INTERVAL box(int i) const {
+    return makeDDI(x_[i].glb(),x_[i].lub());
+  }
+};
+}}}
+#endif
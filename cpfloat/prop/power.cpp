@@ -21,15 +21,44 @@
  */
 
 #include <cpfloat/prop/power.hh>
+#include <cpfloat/prop/equality.hh>
 
 namespace MPG {
   using namespace CPFloat;
   using namespace CPFloat::Prop;
-  void power(Gecode::Space& home, CPFloatVar x, int e, CPFloatVar y) {
+  template <class B, class P>
+  void power(Gecode::Space& home, CPFloatVarT<B,P> x, int e, CPFloatVarT<B,P> y) {
     if (home.failed()) return;
+    if (e < 0)
+      throw OutOfLimits("CPFloat::power");
     
-    CPFloatView left(x);
-    CPFloatView right(y);
-    GECODE_ES_FAIL((Power<CPFloatView,CPFloatView>::post(home,left,e,right)));
+    CPFloatViewT<B,P> left(x);
+    CPFloatViewT<B,P> right(y);
+    switch (e) {
+    case 0:
+      if (Gecode::me_failed(right.narrow(home,1.0,1.0)))
+        home.fail();
+      break;
+    case 1:
+      GECODE_ES_FAIL((Equality<CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left,right)));
+      break;
+    case 2:
+      GECODE_ES_FAIL((Power<CPFloatViewT<B,P>,CPFloatViewT<B,P>,PowSquare>::post(home,left,e,right)));
+      break;
+    case 3:
+      GECODE_ES_FAIL((Power<CPFloatViewT<B,P>,CPFloatViewT<B,P>,PowCube>::post(home,left,e,right)));
+      break;
+    default:
+      if (e % 2 == 0) {
+        GECODE_ES_FAIL((Power<CPFloatViewT<B,P>,CPFloatViewT<B,P>,PowEven>::post(home,left,e,right)));
+      } else {
+        GECODE_ES_FAIL((Power<CPFloatViewT<B,P>,CPFloatViewT<B,P>,PowOdd>::post(home,left,e,right)));
+      }
+    }
   }  
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void power(Gecode::Space&, CPFloatVarT<B,P >, int, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
 }
@@ -26,11 +26,77 @@
 #include <cpfloat/cpfloat.hh>
 
 namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Narrowing of \f$ x ^ e = z \f$ for an even exponent \f$ e \geq 2 \f$
+ *
+ * \f$ x ^ e \f$ only depends on \f$ |x| \f$, the inverse image of
+ * \a z is the pair of intervals \f$ \pm [\sqrt[e]{z.lo},\sqrt[e]{z.hi}] \f$.
+ */
+struct PowEven {
+  static int narrow(INTERVAL* x, int e, INTERVAL* z) {
+    INTERVAL y;
+    if (x->lo >= 0.0) {
+      y.lo = pow_int_lo(x->lo,e);
+      y.hi = pow_int_hi(x->hi,e);
+    } else if (x->hi <= 0.0) {
+      y.lo = pow_int_lo(-x->hi,e);
+      y.hi = pow_int_hi(-x->lo,e);
+    } else {
+      y.lo = 0.0;
+      y.hi = pow_int_hi(std::max(-x->lo,x->hi),e);
+    }
+    *z = intersectIII(*z,y);
+    if (z->lo > z->hi) return FAIL;
+    y.lo = root_int_lo(z->lo,e);
+    y.hi = root_int_hi(z->hi,e);
+    return intersect_inv_abs(y,x) && (x->lo <= x->hi);
+  }
+};
+/**
+ * \brief Narrowing of \f$ x ^ e = z \f$ for an odd exponent \f$ e \geq 3 \f$
+ *
+ * \f$ x ^ e \f$ is monotone, both directions only look at the bounds.
+ */
+struct PowOdd {
+  static int narrow(INTERVAL* x, int e, INTERVAL* z) {
+    INTERVAL y;
+    y.lo = (x->lo >= 0.0) ? pow_int_lo(x->lo,e) : -pow_int_hi(-x->lo,e);
+    y.hi = (x->hi >= 0.0) ? pow_int_hi(x->hi,e) : -pow_int_lo(-x->hi,e);
+    *z = intersectIII(*z,y);
+    if (z->lo > z->hi) return FAIL;
+    y.lo = (z->lo >= 0.0) ? root_int_lo(z->lo,e) : -root_int_hi(-z->lo,e);
+    y.hi = (z->hi >= 0.0) ? root_int_hi(z->hi,e) : -root_int_lo(-z->hi,e);
+    *x = intersectIII(*x,y);
+    return x->lo <= x->hi;
+  }
+};
+/// Narrowing of \f$ x ^ 2 = z \f$
+struct PowSquare {
+  static int narrow(INTERVAL* x, int, INTERVAL* z) {
+    return narrow_square(x,z);
+  }
+};
+/// Narrowing of \f$ x ^ 3 = z \f$
+struct PowCube {
+  static int narrow(INTERVAL* x, int, INTERVAL* z) {
+    return PowOdd::narrow(x,3,z);
+  }
+};
+/// Narrowing of \f$ x ^ e = z \f$ for any exponent \f$ e \geq 0 \f$
+struct PowAny {
+  static int narrow(INTERVAL* x, int e, INTERVAL* z) {
+    return narrow_pow_int(x,e,z);
+  }
+};
+
 /**
  * \brief Propagates: \f$ x ^ e = y \f$
+ *
+ * The narrowing is selected at compile time by \a Pow (one of
+ * PowEven, PowOdd, PowSquare, PowCube or PowAny), see power().
  * \ingroup SetProp
  */
-template <typename ViewLeft, typename ViewRight>
+template <typename ViewLeft, typename ViewRight, class Pow = PowAny>
 class Power : public Gecode::Propagator {
 protected:
   /// Left relation of the contraint
@@ -81,23 +147,18 @@ public:
   virtual Gecode::ExecStatus propagate(Gecode::Space& home,
                                        const Gecode::ModEventDelta&)  {
 
-      cout << " *** Power::propagate *** " << left_ << " " << right_ << endl;
-
-    INTERVAL x,y,z;
+    INTERVAL x,z;
     x.lo = left_.glb();
     x.hi = left_.lub();
-    y.lo = e_;
-    y.hi = e_;
     z.lo = right_.glb();
     z.hi = right_.lub();
 
-    narrow_pow_odd(&x,&y,&z);
+    if (!Pow::narrow(&x,e_,&z))
+      return Gecode::ES_FAILED;
 
-    GECODE_ME_CHECK(left_.leq(home,x.hi));
-    GECODE_ME_CHECK(left_.geq(home,x.lo));
+    GECODE_ME_CHECK(left_.narrow(home,x.lo,x.hi));
 
-    GECODE_ME_CHECK(right_.leq(home,z.hi));
-    GECODE_ME_CHECK(right_.geq(home,z.lo));
+    GECODE_ME_CHECK(right_.narrow(home,z.lo,z.hi));
 
     // Propagator subsumpiton
     if (left_.assigned() && right_.assigned())
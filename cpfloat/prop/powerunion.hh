@@ -0,0 +1,132 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_PROP_POWERUNION_HH__
+#define __CPFLOAT_PROP_POWERUNION_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Propagates: \f$ x ^ e = y \f$ on a union variable \a x
+ * \ingroup SetProp
+ *
+ * The image of \a x is the hull of the images of its intervals. For an
+ * even \a e, \a x is intersected with \f$ -\sqrt[e]{y} \cup \sqrt[e]{y} \f$,
+ * which cuts the hole around zero that the bound propagator can only
+ * find by bisection.
+ */
+template <typename ViewLeft, typename ViewRight>
+class PowerUnion : public Gecode::Propagator {
+protected:
+  /// Left relation of the contraint
+  ViewLeft left_;
+  /// Exponent relation of the contraint
+  int e_;
+  /// Right relation of the constraint
+  ViewRight right_;
+public:
+  /// Constructor for the propagator \f$ PowerUnion(left,e,right) \f$
+  PowerUnion(Gecode::Home home, ViewLeft left, int e,ViewRight right)
+    : Gecode::Propagator(home), left_(left), e_(e), right_(right) {
+    left_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
+    right_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
+  }
+  /// Propagator posting
+  static Gecode::ExecStatus post(Gecode::Home home,
+                                 ViewLeft left, int e, ViewRight right) {
+    (void) new (home) PowerUnion(home,left,e,right);
+    return Gecode::ES_OK;
+  }
+  /// Propagator disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    left_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    right_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+  /// Copy constructor
+  PowerUnion(Gecode::Space& home, bool share, PowerUnion& p)
+    : Gecode::Propagator(home,share,p) {
+    left_.update(home,share,p.left_);
+    e_ = p.e_;
+    right_.update(home,share,p.right_);
+  }
+  /// Copy
+  virtual Gecode::Propagator* copy(Gecode::Space& home, bool share) {
+    return new (home) PowerUnion(home,share,*this);
+  }
+  /// Cost
+  virtual Gecode::PropCost cost(const Gecode::Space&,
+                                const Gecode::ModEventDelta&) const {
+    return Gecode::PropCost::binary(Gecode::PropCost::HI);
+  }
+  /// Main propagation algorithm
+  virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                       const Gecode::ModEventDelta&)  {
+
+    // forward: hull of the images of the intervals of x
+    INTERVAL x,z;
+    x.lo = left_.lo(0);
+    x.hi = left_.hi(0);
+    z = pow_intII(x,e_);
+    for (int i=1; i<left_.pieces(); i++) {
+      x.lo = left_.lo(i);
+      x.hi = left_.hi(i);
+      INTERVAL t = pow_intII(x,e_);
+      z.lo = std::min(z.lo,t.lo);
+      z.hi = std::max(z.hi,t.hi);
+    }
+    GECODE_ME_CHECK(right_.narrow(home,z.lo,z.hi));
+
+    // backward: roots of y
+    BoundType l = right_.glb();
+    BoundType u = right_.lub();
+    BoundType r[4];
+    int m;
+    if (e_ % 2 == 0) {
+      if (u < 0.0)
+        return Gecode::ES_FAILED;
+      if (l < 0.0) l = 0.0;
+      BoundType rl = root_int_lo(l,e_);
+      BoundType ru = root_int_hi(u,e_);
+      if (rl > 0.0) {
+        r[0] = -ru; r[1] = -rl; r[2] = rl; r[3] = ru; m = 2;
+      } else {
+        r[0] = -ru; r[1] = ru; m = 1;
+      }
+    } else {
+      r[0] = (l >= 0.0) ? root_int_lo(l,e_) : -root_int_hi(-l,e_);
+      r[1] = (u >= 0.0) ? root_int_hi(u,e_) : -root_int_lo(-u,e_);
+      m = 1;
+    }
+    GECODE_ME_CHECK(left_.inter(home,r,m));
+
+    // Propagator subsumpiton
+    if (left_.assigned() && right_.assigned())
+      return home.ES_SUBSUMED(*this);
+
+    return Gecode::ES_FIX;
+  }
+};
+}}}
+#endif
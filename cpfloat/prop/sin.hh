@@ -37,10 +37,14 @@ protected:
   ViewLeft left_;
   /// Right relation of the constraint
   ViewRight right_;
+  /// Cached range reductions of the bounds of \a left_
+  TRIG_REDUCTION lo_, hi_;
 public:
   /// Constructor for the propagator \f$ sin(left,right) \f$
   Sin(Gecode::Home home, ViewLeft left, ViewRight right)
     : Gecode::Propagator(home), left_(left), right_(right) {
+    trig_reduction_init(&lo_);
+    trig_reduction_init(&hi_);
     left_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
     right_.subscribe(home,*this,CPFloat::PC_CPFLOAT_BND);
   }
@@ -61,7 +65,7 @@ public:
   }
   /// Copy constructor
   Sin(Gecode::Space& home, bool share, Sin& p)
-    : Gecode::Propagator(home,share,p) {
+    : Gecode::Propagator(home,share,p), lo_(p.lo_), hi_(p.hi_) {
     left_.update(home,share,p.left_);
     right_.update(home,share,p.right_);
   }
@@ -84,13 +88,12 @@ public:
     y.lo = right_.glb();
     y.hi = right_.lub();
 
-    narrow_sin(&x,&y);
+    if (!narrow_sin_cached(&x,&y,&lo_,&hi_))
+      return Gecode::ES_FAILED;
 
-    GECODE_ME_CHECK(left_.leq(home,x.hi));
-    GECODE_ME_CHECK(left_.geq(home,x.lo));
+    GECODE_ME_CHECK(left_.narrow(home,x.lo,x.hi));
 
-    GECODE_ME_CHECK(right_.leq(home,y.hi));
-    GECODE_ME_CHECK(right_.geq(home,y.lo));
+    GECODE_ME_CHECK(right_.narrow(home,y.lo,y.hi));
 
     // Propagator subsumpiton
     if (left_.assigned() && right_.assigned())
@@ -0,0 +1,117 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_PROP_SINCOS_HH__
+#define __CPFLOAT_PROP_SINCOS_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat { namespace Prop {
+/**
+ * \brief Propagates: \f$ s = sin(x) \land c = cos(x) \f$
+ *
+ * Both functions are narrowed from a single range reduction of the
+ * bounds of \a x, and \a s and \a c are also narrowed with each
+ * other through \f$ s^2 + c^2 = 1 \f$.
+ * \ingroup SetProp
+ */
+template <typename ViewX, typename ViewSin, typename ViewCos>
+class SinCos : public Gecode::Propagator {
+protected:
+  /// Argument of the functions
+  ViewX x_;
+  /// Sine of the argument
+  ViewSin s_;
+  /// Cosine of the argument
+  ViewCos c_;
+  /// Cached range reductions of the bounds of \a x_
+  TRIG_REDUCTION lo_, hi_;
+public:
+  /// Constructor for the propagator \f$ sincos(x,s,c) \f$
+  SinCos(Gecode::Home home, ViewX x, ViewSin s, ViewCos c)
+    : Gecode::Propagator(home), x_(x), s_(s), c_(c) {
+    trig_reduction_init(&lo_);
+    trig_reduction_init(&hi_);
+    x_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
+    s_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
+    c_.subscribe(home,*this, CPFloat::PC_CPFLOAT_BND);
+  }
+  /// Propagator posting
+  static Gecode::ExecStatus post(Gecode::Home home,
+                                 ViewX x, ViewSin s, ViewCos c) {
+    (void) new (home) SinCos(home,x,s,c);
+    return Gecode::ES_OK;
+  }
+  /// Propagator disposal
+  virtual size_t dispose(Gecode::Space& home) {
+    x_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    s_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    c_.cancel(home,*this,CPFloat::PC_CPFLOAT_BND);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+  /// Copy constructor
+  SinCos(Gecode::Space& home, bool share, SinCos& p)
+    : Gecode::Propagator(home,share,p), lo_(p.lo_), hi_(p.hi_) {
+    x_.update(home,share,p.x_);
+    s_.update(home,share,p.s_);
+    c_.update(home,share,p.c_);
+  }
+  /// Copy
+  virtual Gecode::Propagator* copy(Gecode::Space& home, bool share) {
+    return new (home) SinCos(home,share,*this);
+  }
+  /// Cost
+  virtual Gecode::PropCost cost(const Gecode::Space&,
+                                const Gecode::ModEventDelta&) const {
+    return Gecode::PropCost::ternary(Gecode::PropCost::LO);
+  }
+  /// Main propagation algorithm
+  virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                       const Gecode::ModEventDelta&)  {
+
+    INTERVAL x,s,c;
+    x.lo = x_.glb();
+    x.hi = x_.lub();
+    s.lo = s_.glb();
+    s.hi = s_.lub();
+    c.lo = c_.glb();
+    c.hi = c_.lub();
+
+    if (!narrow_sincos_cached(&x,&s,&c,&lo_,&hi_))
+      return Gecode::ES_FAILED;
+
+    GECODE_ME_CHECK(x_.narrow(home,x.lo,x.hi));
+
+    GECODE_ME_CHECK(s_.narrow(home,s.lo,s.hi));
+
+    GECODE_ME_CHECK(c_.narrow(home,c.lo,c.hi));
+
+    // Propagator subsumpiton
+    if (x_.assigned() && s_.assigned() && c_.assigned())
+      return home.ES_SUBSUMED(*this);
+
+    return Gecode::ES_FIX;
+  }
+};
+}}}
+#endif
@@ -83,14 +83,11 @@ public:
   virtual Gecode::ExecStatus propagate(Gecode::Space& home,
                                        const Gecode::ModEventDelta&)  {
 
-    GECODE_ME_CHECK(right_.leq(home,left1_.lub()-left2_.glb()));
-    GECODE_ME_CHECK(right_.geq(home,left1_.glb()-left2_.lub()));
+    GECODE_ME_CHECK(right_.narrow(home,left1_.glb()-left2_.lub(),left1_.lub()-left2_.glb()));
 
-    GECODE_ME_CHECK(left2_.leq(home,right_.lub()-left1_.glb()));
-    GECODE_ME_CHECK(left2_.geq(home,right_.glb()-left1_.lub()));
+    GECODE_ME_CHECK(left2_.narrow(home,right_.glb()-left1_.lub(),right_.lub()-left1_.glb()));
 
-    GECODE_ME_CHECK(left1_.leq(home,right_.lub()+left2_.lub()));
-    GECODE_ME_CHECK(left1_.geq(home,right_.glb()+left2_.glb()));
+    GECODE_ME_CHECK(left1_.narrow(home,right_.glb()+left2_.glb(),right_.lub()+left2_.lub()));
 
     // Propagator subsumpiton
     if (left1_.assigned() && left2_.assigned() && right_.assigned())
@@ -21,16 +21,43 @@
  */
 
 #include <cpfloat/prop/times.hh>
+#include <cpfloat/prop/equality.hh>
 
 namespace MPG {
   using namespace CPFloat;
   using namespace CPFloat::Prop;
-  void times(Gecode::Space& home, CPFloatVar x, CPFloatVar y, CPFloatVar z) {
+  template <class B, class P>
+  void times(Gecode::Space& home, CPFloatVarT<B,P> x, CPFloatVarT<B,P> y, CPFloatVarT<B,P> z) {
     if (home.failed()) return;
     
-    CPFloatView left1(x);
-    CPFloatView left2(y);
-    CPFloatView right(z);
-    GECODE_ES_FAIL((Times<CPFloatView,CPFloatView,CPFloatView>::post(home,left1,left2,right)));
+    CPFloatViewT<B,P> left1(x);
+    CPFloatViewT<B,P> left2(y);
+    CPFloatViewT<B,P> right(z);
+    GECODE_ES_FAIL((Times<CPFloatViewT<B,P>,CPFloatViewT<B,P>,CPFloatViewT<B,P> >::post(home,left1,left2,right)));
   }  
+
+  template <class B, class P>
+  void times(Gecode::Space& home, CPFloatVarT<B,P> x, BoundType c, CPFloatVarT<B,P> z) {
+    if (home.failed()) return;
+
+    CPFloatViewT<B,P> vx(x);
+    CPFloatViewT<B,P> right(z);
+    if (c > 0.0) {
+      ScaleView<CPFloatViewT<B,P> > left(vx,c);
+      GECODE_ES_FAIL((Equality<ScaleView<CPFloatViewT<B,P> >,CPFloatViewT<B,P> >::post(home,left,right)));
+    } else if (c < 0.0) {
+      ScaleView<CPFloatViewT<B,P> > left(vx,-c);
+      MinusView<CPFloatViewT<B,P> > mright(right);
+      GECODE_ES_FAIL((Equality<ScaleView<CPFloatViewT<B,P> >,MinusView<CPFloatViewT<B,P> > >::post(home,left,mright)));
+    } else {
+      ConstCPFloatView zero(0.0);
+      GECODE_ES_FAIL((Equality<CPFloatViewT<B,P>,ConstCPFloatView>::post(home,right,zero)));
+    }
+  }
+
+#define CPFLOAT_INSTANTIATE(B,P) \
+  template void times(Gecode::Space&, CPFloatVarT<B,P >, CPFloatVarT<B,P >, CPFloatVarT<B,P >); \
+  template void times(Gecode::Space&, CPFloatVarT<B,P >, BoundType, CPFloatVarT<B,P >);
+  CPFLOAT_FOREACH_VAR_TYPE(CPFLOAT_INSTANTIATE)
+#undef CPFLOAT_INSTANTIATE
 }
@@ -0,0 +1,366 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#ifndef __CPFLOAT_SEARCH_BOX_HH__
+#define __CPFLOAT_SEARCH_BOX_HH__
+
+#include <gecode/search.hh>
+#include <cpfloat/cpfloat.hh>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace MPG { namespace CPFloat {
+
+/**
+ * \brief Options of the box search engines
+ *
+ * \a memory bounds the memory of the spaces kept in the queue, in
+ * bytes (0 for no bound). When the bound is exceeded the worst half of
+ * the queue is written to a temporary file if \a spill is set, and the
+ * search is stopped otherwise.
+ */
+class BoxOptions : public Gecode::Search::Options {
+public:
+  /// Memory bound of the queue in bytes, 0 for none
+  size_t memory;
+  /// Whether boxes are spilled to disk above the memory bound
+  bool spill;
+  /// Default options
+  BoxOptions(void)
+    : memory(0), spill(false) {}
+  /// Options \a o of the Gecode engines, without memory bound
+  BoxOptions(const Gecode::Search::Options& o)
+    : Gecode::Search::Options(o), memory(0), spill(false) {}
+};
+
+/// Orders the spaces by the lower bound of their objective
+template <class T>
+struct LowestBound {
+  /// Whether solutions constrain the rest of the search
+  static const bool constrain = true;
+  /// Returns the priority of \a s, smallest first
+  static BoundType key(const T& s) {
+    return s.cost().glb();
+  }
+};
+
+/// Orders the spaces by the width of their widest variable
+template <class T>
+struct WidestBox {
+  /// Whether solutions constrain the rest of the search
+  static const bool constrain = false;
+  /// Returns the priority of \a s, smallest first
+  static BoundType key(const T& s) {
+    CPFloatVarArgs x = s.variables();
+    BoundType w = 0.0;
+    for (int i=0; i<x.size(); i++)
+      w = std::max(w,x[i].lub() - x[i].glb());
+    return -w;
+  }
+};
+
+/**
+ * \brief Search that always expands the queued space of smallest key
+ *
+ * The children of a space are propagated as soon as they are created,
+ * failed ones are dropped and the others are queued with the key \a K
+ * of their box, so the order follows the propagated domains. Spaces
+ * are returned as solutions when they are taken from the queue.
+ *
+ * The space \a T returns the variables of its box with
+ * <code>CPFloatVarArgs variables(void) const</code>. A spilled space
+ * is stored as its key, its depth and the bounds of these variables; it
+ * is read back as a clone of the root narrowed to the box. Its domains
+ * then depend only on the box, so when the box does not determine the
+ * other variables (see MinimizeSpace::variables()) the restored space
+ * may be larger than the spilled one and its solutions may overlap
+ * others. The spilled boxes form runs sorted by key, and a run is read
+ * from when its next box comes before the top of the queue, so the
+ * order of the search does not change.
+ *
+ * The search is sequential, the number of threads of the options is
+ * not used.
+ */
+template <class T, class K>
+class BoxSearch {
+protected:
+  /// Queued space
+  struct Node {
+    /// Space, propagated
+    T* s;
+    /// Key of the space
+    BoundType key;
+    /// Depth in the search tree
+    unsigned long int depth;
+    /// Memory of the space
+    size_t memory;
+  };
+  /// Sequence of spilled boxes sorted by key
+  struct Run {
+    /// Position of the next box in the file
+    long int pos;
+    /// Number of boxes left
+    unsigned long int left;
+    /// Key of the next box
+    BoundType key;
+  };
+  /// Order of the queue, the heap keeps the smallest key on top
+  static bool after(const Node& a, const Node& b) {
+    return a.key > b.key;
+  }
+  /// Order of the nodes by key
+  static bool before(const Node& a, const Node& b) {
+    return a.key < b.key;
+  }
+  /// Root space, NULL when it failed
+  T* root_;
+  /// Last solution, NULL before the first
+  T* best_;
+  /// Options
+  BoxOptions o_;
+  /// Heap of the queued spaces
+  std::vector<Node> queue_;
+  /// Memory of the queued spaces
+  size_t memory_;
+  /// Spill file, NULL before the first spill
+  std::FILE* file_;
+  /// Runs of the spill file that have boxes left
+  std::vector<Run> runs_;
+  /// Statistics
+  Gecode::Search::Statistics stat_;
+  /// Whether the last call to next() was stopped
+  bool stopped_;
+  /// Writes \a n items at \a p to the spill file
+  template <class V>
+  void write(const V* p, size_t n) {
+    if (std::fwrite(p,sizeof(V),n,file_) != n)
+      throw SpillFailed("BoxSearch::write");
+  }
+  /// Reads \a n items at \a p from the spill file
+  template <class V>
+  void read(V* p, size_t n) {
+    if (std::fread(p,sizeof(V),n,file_) != n)
+      throw SpillFailed("BoxSearch::read");
+  }
+  /// Queues \a s at depth \a d
+  void push(T* s, unsigned long int d) {
+    Node n;
+    n.s = s;
+    n.key = K::key(*s);
+    n.depth = d;
+    n.memory = s->allocated();
+    queue_.push_back(n);
+    std::push_heap(queue_.begin(),queue_.end(),after);
+    memory_ += n.memory;
+    stat_.depth = std::max(stat_.depth,d);
+    stat_.memory = std::max(stat_.memory,memory_);
+  }
+  /// Reads the next box of the run \a r into \a n
+  void restore(unsigned int r, Node& n) {
+    Run& run = runs_[r];
+    if (std::fseek(file_,run.pos,SEEK_SET) != 0)
+      throw SpillFailed("BoxSearch::restore");
+    read(&n.key,1);
+    read(&n.depth,1);
+    n.s = static_cast<T*>(root_->clone());
+    n.memory = 0;
+    CPFloatVarArgs x = n.s->variables();
+    for (int i=0; i<x.size(); i++) {
+      BoundType b[2];
+      read(b,2);
+      if (Gecode::me_failed(CPFloatView(x[i]).narrow(*n.s,b[0],b[1])))
+        n.s->fail();
+    }
+    if (--run.left > 0) {
+      run.pos = std::ftell(file_);
+      read(&run.key,1);
+    } else {
+      runs_.erase(runs_.begin()+r);
+    }
+  }
+  /// Takes the space of smallest key into \a n, returns false when none
+  bool pop(Node& n) {
+    int r = -1;
+    for (unsigned int i=0; i<runs_.size(); i++)
+      if ((r < 0) || (runs_[i].key < runs_[r].key))
+        r = i;
+    if ((r >= 0) && (queue_.empty() || (runs_[r].key < queue_.front().key))) {
+      restore(r,n);
+      return true;
+    }
+    if (queue_.empty())
+      return false;
+    std::pop_heap(queue_.begin(),queue_.end(),after);
+    n = queue_.back();
+    queue_.pop_back();
+    memory_ -= n.memory;
+    return true;
+  }
+  /// Writes the queued spaces beyond half the memory bound to a new run
+  void spill(void) {
+    if ((file_ == NULL) && ((file_ = std::tmpfile()) == NULL))
+      throw SpillFailed("BoxSearch::spill");
+    std::sort(queue_.begin(),queue_.end(),before);
+    size_t keep = 0;
+    size_t m = 0;
+    while ((keep < queue_.size()) &&
+           (m + queue_[keep].memory <= o_.memory / 2))
+      m += queue_[keep++].memory;
+    if (keep == queue_.size())
+      return;
+    if (std::fseek(file_,0,SEEK_END) != 0)
+      throw SpillFailed("BoxSearch::spill");
+    Run run;
+    run.pos = std::ftell(file_);
+    run.left = queue_.size() - keep;
+    run.key = queue_[keep].key;
+    for (size_t i=keep; i<queue_.size(); i++) {
+      write(&queue_[i].key,1);
+      write(&queue_[i].depth,1);
+      CPFloatVarArgs x = queue_[i].s->variables();
+      for (int j=0; j<x.size(); j++) {
+        BoundType b[2] = {x[j].glb(), x[j].lub()};
+        write(b,2);
+      }
+      delete queue_[i].s;
+    }
+    // the kept spaces are sorted, which is a heap for after()
+    queue_.resize(keep);
+    memory_ = m;
+    runs_.push_back(run);
+  }
+public:
+  /// Constructor for a search of \a s
+  BoxSearch(T* s, const BoxOptions& o=BoxOptions())
+    : root_(NULL), best_(NULL), o_(o), memory_(0), file_(NULL),
+      stopped_(false) {
+    stat_.node++;
+    if (s->status() == Gecode::SS_FAILED) {
+      stat_.fail++;
+      return;
+    }
+    root_ = static_cast<T*>(s->clone());
+    push(static_cast<T*>(s->clone()),0);
+  }
+  /// Destructor
+  ~BoxSearch(void) {
+    for (size_t i=0; i<queue_.size(); i++)
+      delete queue_[i].s;
+    delete root_;
+    delete best_;
+    if (file_ != NULL)
+      std::fclose(file_);
+  }
+  /// Returns the next solution, NULL when there is none or when stopped
+  T* next(void) {
+    stopped_ = false;
+    for (;;) {
+      if ((o_.stop != NULL) && o_.stop->stop(stat_,o_)) {
+        stopped_ = true;
+        return NULL;
+      }
+      Node n;
+      if (!pop(n))
+        return NULL;
+      T* s = n.s;
+      if (K::constrain && (best_ != NULL))
+        s->constrain(*best_);
+      switch (s->status()) {
+      case Gecode::SS_FAILED:
+        stat_.fail++;
+        delete s;
+        break;
+      case Gecode::SS_SOLVED:
+        if (K::constrain) {
+          delete best_;
+          best_ = static_cast<T*>(s->clone());
+        }
+        return s;
+      case Gecode::SS_BRANCH:
+        {
+          const Gecode::Choice* c = s->choice();
+          unsigned int a = c->alternatives();
+          for (unsigned int i=0; i<a; i++) {
+            T* t = (i+1 < a) ? static_cast<T*>(s->clone()) : s;
+            t->commit(*c,i);
+            stat_.node++;
+            if (t->status() == Gecode::SS_FAILED) {
+              stat_.fail++;
+              delete t;
+            } else {
+              push(t,n.depth+1);
+            }
+          }
+          delete c;
+        }
+        break;
+      }
+      if ((o_.memory > 0) && (memory_ > o_.memory)) {
+        if (!o_.spill) {
+          stopped_ = true;
+          return NULL;
+        }
+        spill();
+      }
+    }
+  }
+  /// Whether the last call to next() was stopped
+  bool stopped(void) const {
+    return stopped_;
+  }
+  /// Returns the statistics of the search
+  Gecode::Search::Statistics statistics(void) const {
+    return stat_;
+  }
+};
+
+/**
+ * \brief Best-first search, smallest lower bound of the objective first
+ *
+ * For a MinimizeSpace: every solution constrains the spaces expanded
+ * after it, as in Gecode::BAB, and the solutions come in increasing
+ * order of the lower bound of their objective.
+ */
+template <class T>
+class BestFirst : public BoxSearch<T,LowestBound<T> > {
+public:
+  /// Constructor for a search of \a s
+  BestFirst(T* s, const BoxOptions& o=BoxOptions())
+    : BoxSearch<T,LowestBound<T> >(s,o) {}
+};
+
+/**
+ * \brief Breadth-first search, largest box first
+ *
+ * Spreads the search over the whole domain, which gives an even
+ * coverage of a paving when the search is stopped early.
+ */
+template <class T>
+class BreadthFirst : public BoxSearch<T,WidestBox<T> > {
+public:
+  /// Constructor for a search of \a s
+  BreadthFirst(T* s, const BoxOptions& o=BoxOptions())
+    : BoxSearch<T,WidestBox<T> >(s,o) {}
+};
+
+}}
+#endif
@@ -0,0 +1,105 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_SEARCH_INCUMBENT_HH__
+#define __CPFLOAT_SEARCH_INCUMBENT_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+namespace MPG { namespace CPFloat {
+
+/**
+ * \brief Best upper bound shared by all the workers of a search
+ *
+ * The bound is kept as the bits of a double and only ever decreases.
+ * Reads are plain loads and improve() is a compare-and-swap loop, so
+ * no worker blocks on it. The object is reference counted with atomic
+ * increments, as it is referenced from spaces in every thread and may
+ * outlive the search that created it.
+ */
+class Incumbent {
+protected:
+  /// Bits of the bound
+  volatile boost::uint64_t bits_;
+  /// Number of references
+  volatile int refs_;
+  /// Returns the bits of \a v
+  static boost::uint64_t pack(BoundType v) {
+    boost::uint64_t b;
+    std::memcpy(&b,&v,sizeof(b));
+    return b;
+  }
+  /// Constructor
+  Incumbent(void)
+    : bits_(pack(std::numeric_limits<BoundType>::infinity())), refs_(1) {}
+public:
+  /// Returns a new incumbent at infinity with one reference
+  static Incumbent* create(void) {
+    return new Incumbent();
+  }
+  /// Adds a reference
+  Incumbent* share(void) {
+    (void) __sync_fetch_and_add(&refs_,1);
+    return this;
+  }
+  /// Drops a reference, deleting the object with the last one
+  void release(void) {
+    if (__sync_sub_and_fetch(&refs_,1) == 0)
+      delete this;
+  }
+  /// Returns the bound
+  BoundType get(void) const {
+    boost::uint64_t b = bits_;
+    BoundType v;
+    std::memcpy(&v,&b,sizeof(v));
+    return v;
+  }
+  /// Lowers the bound to \a u, returns whether it was improved
+  bool improve(BoundType u) {
+    for (;;) {
+      boost::uint64_t o = bits_;
+      BoundType v;
+      std::memcpy(&v,&o,sizeof(v));
+      if (!(u < v))
+        return false;
+      if (__sync_bool_compare_and_swap(&bits_,o,pack(u)))
+        return true;
+    }
+  }
+};
+
+/**
+ * \brief Largest objective value still searched for the upper bound \a u
+ *
+ * A new solution must improve \a u by \f$ \max(a, r|u|) \f$, rounded so
+ * that the returned value is never above the exact difference.
+ */
+inline BoundType
+next_bound(BoundType u, BoundType a, BoundType r) {
+  if (u == std::numeric_limits<BoundType>::infinity())
+    return u;
+  boost::numeric::interval_lib::rounded_math<BoundType> rnd;
+  return rnd.sub_down(u,std::max(a,r*std::fabs(u)));
+}
+
+}}
+#endif
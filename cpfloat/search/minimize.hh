@@ -0,0 +1,243 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_SEARCH_MINIMIZE_HH__
+#define __CPFLOAT_SEARCH_MINIMIZE_HH__
+
+#include <gecode/search.hh>
+#include <cpfloat/cpfloat.hh>
+#include <cpfloat/expression.hh>
+#include <cpfloat/search/incumbent.hh>
+#include <cpfloat/prop/bound.hh>
+
+namespace MPG { namespace CPFloat {
+
+/**
+ * \brief Space for the global minimization of an objective
+ *
+ * The model sets its objective with objective() and returns the
+ * variables that determine a point with variables(). Every solution
+ * found by a branch and bound engine is probed: a clone of the solution
+ * has the variables fixed at their medians, and when propagation does
+ * not fail the upper bound of the objective is an upper bound of the
+ * minimum. constrain() then posts \f$ f \leq u - \epsilon \f$ for the
+ * best upper bound \f$ u \f$, with
+ * \f$ \epsilon = \max(a, r|u|) \f$ for the absolute and relative
+ * tolerances \f$ a \f$ and \f$ r \f$.
+ *
+ * The probe certifies \f$ u \f$ when the variables not returned by
+ * variables() are functions of the probed ones (as the objective is)
+ * and every constraint holds at the probe. Equality constraints between
+ * probed variables only hold up to the outward rounding of the
+ * propagators.
+ *
+ * With a shared Incumbent (see share()) the probes of every space
+ * lower it, and a propagator prunes every node against it as soon as
+ * a decision variable changes, so parallel workers benefit from each
+ * other's bounds without waiting for the engine to pass them on.
+ */
+class MinimizeSpace : public Gecode::Space {
+protected:
+  /// Objective
+  CPFloatVar f_;
+  /// Best upper bound of the objective known to this space
+  mutable BoundType ub_;
+  /// Whether this space has been probed
+  mutable bool probed_;
+  /// Absolute tolerance
+  BoundType abs_;
+  /// Relative tolerance
+  BoundType rel_;
+  /// Shared upper bound, NULL when not shared
+  Incumbent* inc_;
+  /// Sets the objective to \a f
+  void objective(CPFloatVar f) {
+    f_ = f;
+  }
+  /// Sets the objective to the expression \a e
+  void objective(Expression& e) {
+    f_ = CPFloatVar(*this,Limits::min,Limits::max);
+    VarExpression f(f_);
+    hc4(*this, f == e);
+  }
+public:
+  /// Constructor with the absolute and relative tolerances \a a and \a r
+  MinimizeSpace(BoundType a=1e-6, BoundType r=1e-6)
+    : ub_(std::numeric_limits<BoundType>::infinity()), probed_(false),
+      abs_(a), rel_(r), inc_(NULL) {}
+  /// Constructor for cloning \a s
+  MinimizeSpace(bool share, MinimizeSpace& s)
+    : Gecode::Space(share,s), ub_(s.ub_), probed_(false),
+      abs_(s.abs_), rel_(s.rel_),
+      inc_((s.inc_ != NULL) ? s.inc_->share() : NULL) {
+    f_.update(*this,share,s.f_);
+  }
+  /// Destructor
+  virtual ~MinimizeSpace(void) {
+    if (inc_ != NULL)
+      inc_->release();
+  }
+  /// Share the upper bound \a inc with the other spaces of a search
+  void share(Incumbent* inc) {
+    if (inc_ != NULL)
+      inc_->release();
+    inc_ = inc->share();
+    if (failed())
+      return;
+    Gecode::ViewArray<CPFloatView> x(*this,variables());
+    (void) Prop::Bound<CPFloatView>::post(*this,x,f_,inc_,abs_,rel_);
+  }
+  /// Variables fixed by the probe
+  virtual CPFloatVarArgs variables(void) const = 0;
+  /// Returns the objective
+  CPFloatVar cost(void) const {
+    return f_;
+  }
+  /// Returns the best upper bound of the objective, probing this space
+  BoundType upper(void) const {
+    if (!probed_) {
+      probed_ = true;
+      MinimizeSpace* c = static_cast<MinimizeSpace*>(clone());
+      CPFloatVarArgs x = c->variables();
+      bool failed = false;
+      for (int i=0; !failed && (i<x.size()); i++) {
+        CPFloatView v(x[i]);
+        BoundType m = v.median();
+        failed = Gecode::me_failed(v.narrow(*c,m,m));
+      }
+      if (!failed && (c->status() != Gecode::SS_FAILED))
+        ub_ = std::min(ub_,c->f_.lub());
+      delete c;
+      if (inc_ != NULL)
+        (void) inc_->improve(ub_);
+    }
+    return ub_;
+  }
+  /// Returns the largest value still searched for the upper bound \a u
+  BoundType cut(BoundType u) const {
+    return next_bound(u,abs_,rel_);
+  }
+  /// Returns the absolute tolerance
+  BoundType absolute(void) const {
+    return abs_;
+  }
+  /// Returns the relative tolerance
+  BoundType relative(void) const {
+    return rel_;
+  }
+  /// Only look for a better upper bound than the one of \a best
+  virtual void constrain(const Gecode::Space& best) {
+    ub_ = std::min(ub_,static_cast<const MinimizeSpace&>(best).upper());
+    if (inc_ != NULL)
+      ub_ = std::min(ub_,inc_->get());
+    BoundType u = cut(ub_);
+    if (u == std::numeric_limits<BoundType>::infinity())
+      return;
+    if (Gecode::me_failed(CPFloatView(f_).leq(*this,u)))
+      fail();
+  }
+};
+
+/**
+ * \brief Branch and bound minimization with a certified enclosure
+ *
+ * Runs the engine \a E (Gecode::BAB or BestFirst, which call
+ * constrain()) on a MinimizeSpace. Each solution is a box whose probe
+ * may improve the upper bound. Once next() has returned NULL without being
+ * stopped, the global minimum lies in \f$ [lower(), upper()] \f$: every
+ * point is either in a solution box, whose objective is at least its
+ * lower bound, or was pruned because its objective exceeds the cut of
+ * an upper bound, which is at least the cut of the final one. An
+ * infeasible problem gives \f$ [\infty,\infty] \f$.
+ *
+ * The upper bound is shared through an Incumbent with all the spaces of
+ * the search (see MinimizeSpace::share()), so with several threads in
+ * the options the workers of Gecode::BAB, which steal work from each
+ * other, prune against the best bound of any of them.
+ */
+template <class T, template<class> class E = Gecode::BAB>
+class Minimize {
+protected:
+  /// Shared upper bound
+  Incumbent* inc_;
+  /// Search engine
+  E<T> e_;
+  /// Smallest lower bound of the objective over the solutions
+  BoundType lo_;
+  /// Best upper bound
+  BoundType hi_;
+  /// Absolute tolerance
+  BoundType a_;
+  /// Relative tolerance
+  BoundType r_;
+  /// Shares the upper bound with \a s, returns \a s
+  T* attach(T* s) {
+    s->share(inc_);
+    return s;
+  }
+public:
+  /// Constructor for the minimization of \a s
+  Minimize(T* s, const Gecode::Search::Options& o=Gecode::Search::Options::def)
+    : inc_(Incumbent::create()), e_(attach(s),o),
+      lo_(std::numeric_limits<BoundType>::infinity()),
+      hi_(std::numeric_limits<BoundType>::infinity()),
+      a_(s->absolute()), r_(s->relative()) {}
+  /// Constructor for the minimization of \a s with the options \a o of \a E
+  template <class O>
+  Minimize(T* s, const O& o)
+    : inc_(Incumbent::create()), e_(attach(s),o),
+      lo_(std::numeric_limits<BoundType>::infinity()),
+      hi_(std::numeric_limits<BoundType>::infinity()),
+      a_(s->absolute()), r_(s->relative()) {}
+  /// Destructor
+  ~Minimize(void) {
+    inc_->release();
+  }
+  /// Returns the next solution box, NULL when the search is finished
+  T* next(void) {
+    T* t = e_.next();
+    if (t != NULL) {
+      lo_ = std::min(lo_,t->cost().glb());
+      hi_ = std::min(hi_,t->upper());
+    }
+    return t;
+  }
+  /// Lower bound of the minimum, once the search is finished
+  BoundType lower(void) const {
+    return std::min(lo_,next_bound(upper(),a_,r_));
+  }
+  /// Upper bound of the minimum
+  BoundType upper(void) const {
+    return std::min(hi_,inc_->get());
+  }
+  /// Whether the search was stopped
+  bool stopped(void) const {
+    return e_.stopped();
+  }
+  /// Returns the statistics of the search
+  Gecode::Search::Statistics statistics(void) const {
+    return e_.statistics();
+  }
+};
+
+}}
+#endif
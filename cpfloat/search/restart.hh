@@ -0,0 +1,194 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_SEARCH_RESTART_HH__
+#define __CPFLOAT_SEARCH_RESTART_HH__
+
+#include <gecode/search.hh>
+#include <algorithm>
+#include <climits>
+
+namespace MPG { namespace CPFloat {
+
+/// Sequence of failure limits for restart-based search
+class Cutoff {
+public:
+  /// Destructor
+  virtual ~Cutoff(void) {}
+  /// Returns the failure limit of the next restart
+  virtual unsigned long int operator ()(void) = 0;
+};
+
+/// Luby sequence \f$ 1,1,2,1,1,2,4,1,\ldots \f$ scaled by a factor
+class CutoffLuby : public Cutoff {
+protected:
+  /// Scale factor
+  unsigned long int scale_;
+  /// Position of the next limit in the sequence (from 1)
+  unsigned long int i_;
+  /// Returns the \a i-th element of the Luby sequence
+  static unsigned long int luby(unsigned long int i) {
+    for (;;) {
+      unsigned long int k = 1;
+      while ((1UL << k) - 1 < i)
+        k++;
+      if ((1UL << k) - 1 == i)
+        return 1UL << (k-1);
+      i -= (1UL << (k-1)) - 1;
+    }
+  }
+public:
+  /// Constructor for the limits \a scale times the Luby sequence
+  CutoffLuby(unsigned long int scale)
+    : scale_(scale), i_(1) {}
+  /// Returns the failure limit of the next restart
+  virtual unsigned long int operator ()(void) {
+    return scale_ * luby(i_++);
+  }
+};
+
+/// Geometric sequence \f$ s, sf, sf^2, \ldots \f$
+class CutoffGeometric : public Cutoff {
+protected:
+  /// Next limit
+  double n_;
+  /// Growth factor
+  double f_;
+public:
+  /// Constructor for the limits starting at \a scale growing by \a factor
+  CutoffGeometric(unsigned long int scale, double factor)
+    : n_(static_cast<double>(scale)), f_(factor) {}
+  /// Returns the failure limit of the next restart
+  virtual unsigned long int operator ()(void) {
+    double n = n_;
+    n_ *= f_;
+    return (n < static_cast<double>(ULONG_MAX)) ?
+      static_cast<unsigned long int>(n) : ULONG_MAX;
+  }
+};
+
+/**
+ * \brief Restart-based search
+ *
+ * Runs the engine \a E on the root space, stopping it when its number of
+ * failures reaches the next limit of a Cutoff sequence, and then starts
+ * again from the root. Restarts only pay off when they do not repeat the
+ * same tree: before restart \f$ r \f$ (from 0) the space \a T has
+ * <code>void restart(unsigned int r)</code> called on a fresh clone of
+ * the root, where it usually posts a randomized branching seeded by
+ * \f$ r \f$ (see randselection()).
+ *
+ * The search is complete: when a run exhausts its tree within the limit
+ * there are no more solutions. Solutions found in earlier runs may be
+ * found again, so a satisfaction search should ask for one solution.
+ * The stop object of the options is checked between restarts.
+ */
+template <class T, template<class> class E = Gecode::DFS>
+class RBS {
+protected:
+  /// Root space, NULL when it failed
+  T* root_;
+  /// Limits of the restarts
+  Cutoff& cutoff_;
+  /// Stop object of the user
+  Gecode::Search::Stop* stop_;
+  /// Failure limit of the current run
+  Gecode::Search::FailStop fail_;
+  /// Options of the runs
+  Gecode::Search::Options o_;
+  /// Current run, NULL before the next restart
+  E<T>* e_;
+  /// Number of restarts so far
+  unsigned int restarts_;
+  /// Statistics of the finished runs
+  Gecode::Search::Statistics stat_;
+  /// Whether the search was stopped by the user
+  bool stopped_;
+  /// Adds the statistics \a s of a run to \a t
+  static void add(Gecode::Search::Statistics& t,
+                  const Gecode::Search::Statistics& s) {
+    t.fail += s.fail;
+    t.node += s.node;
+    t.depth = std::max(t.depth,s.depth);
+    t.memory = std::max(t.memory,s.memory);
+  }
+public:
+  /// Constructor for a search of \a s with the restart limits \a c
+  RBS(T* s, Cutoff& c,
+      const Gecode::Search::Options& o=Gecode::Search::Options::def)
+    : root_(NULL), cutoff_(c), stop_(o.stop), fail_(0), o_(o), e_(NULL),
+      restarts_(0), stopped_(false) {
+    o_.stop = &fail_;
+    if (s->status() != Gecode::SS_FAILED)
+      root_ = static_cast<T*>(s->clone());
+  }
+  /// Destructor
+  ~RBS(void) {
+    delete e_;
+    delete root_;
+  }
+  /// Returns the next solution, NULL when there is none or when stopped
+  T* next(void) {
+    if (root_ == NULL)
+      return NULL;
+    for (;;) {
+      if (e_ == NULL) {
+        T* s = static_cast<T*>(root_->clone());
+        s->restart(restarts_);
+        fail_.limit(cutoff_());
+        e_ = new E<T>(s,o_);
+        delete s;
+      }
+      if (T* t = e_->next())
+        return t;
+      bool limited = e_->stopped();
+      add(stat_,e_->statistics());
+      delete e_;
+      e_ = NULL;
+      if (!limited)
+        return NULL;
+      restarts_++;
+      if ((stop_ != NULL) && stop_->stop(stat_,o_)) {
+        stopped_ = true;
+        return NULL;
+      }
+    }
+  }
+  /// Whether the last call to next() was stopped by the user
+  bool stopped(void) const {
+    return stopped_;
+  }
+  /// Returns the statistics of all runs so far
+  Gecode::Search::Statistics statistics(void) const {
+    Gecode::Search::Statistics s = stat_;
+    if (e_ != NULL)
+      add(s,e_->statistics());
+    return s;
+  }
+  /// Returns the number of restarts so far
+  unsigned int restarts(void) const {
+    return restarts_;
+  }
+};
+
+}}
+#endif
@@ -0,0 +1,389 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ *
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __CPFLOAT_UNION_HH__
+#define __CPFLOAT_UNION_HH__
+
+#include <cpfloat/cpfloat.hh>
+
+/// Maximal number of disjoint intervals in the domain of a union variable
+#define CPFLOAT_UNION_SIZE 8
+
+// union variable implementation
+namespace MPG { namespace CPFloat {
+
+/**
+ * \brief Float domain made of disjoint intervals.
+ *
+ * The domain is a sorted list of at most \ref CPFLOAT_UNION_SIZE
+ * disjoint closed intervals allocated in the space. When an
+ * intersection would produce more intervals, the ones separated by the
+ * smallest gaps are merged, so the domain is always a sound
+ * approximation.
+ *
+ * Bound changes are notified as for CPFloatVarImpT. Holes cut inside
+ * the hull are not notified, as the only propagators that can use them
+ * are the ones that cut them.
+ */
+template <class B, class P=VarPrecision<B> >
+class CPFloatUnionVarImpT : public CPFloatVarImpBase, protected P {
+protected:
+  /// Number of intervals in the domain
+  int n_;
+  /// Bounds of the intervals: interval \a i is [d_[2i], d_[2i+1]]
+  B* d_;
+  /// Replaces the domain by the \a m intervals in \a d
+  void set(Space& home, const B* d, int m) {
+    if (m > n_) {
+      home.free<B>(d_,2*n_);
+      d_ = home.alloc<B>(2*m);
+    } else if (m < n_) {
+      home.free<B>(d_+2*m,2*(n_-m));
+    }
+    n_ = m;
+    for (int i=0; i<2*m; i++)
+      d_[i] = d[i];
+  }
+  /// Mod event for the change of the bounds from [\a l, \a u]
+  ModEvent bounds(Space& home, B l, B u) {
+    if (l == glb() && u == lub())
+      return ME_CPFLOAT_NONE;
+    ModEvent me = assigned() ? ME_CPFLOAT_VAL :
+      (l != glb() && u != lub()) ? ME_CPFLOAT_BND :
+      (l != glb()) ? ME_CPFLOAT_MIN : ME_CPFLOAT_MAX;
+    CPFloatDelta d(l,u);
+    return notify(home, me, d);
+  }
+public:
+  /// \a Constructors and disposer
+  //@{
+  /// Constructor for a variable with domain [\a l, \a u]
+  CPFloatUnionVarImpT(Space& home, B l, B u, const P& p=P())
+    : CPFloatVarImpBase(home), P(p), n_(1), d_(home.alloc<B>(2)) {
+    d_[0] = l; d_[1] = u;
+  }
+  /// Resources disposal
+  void dispose(Space&) {}
+  //@}
+  /// \name Domain access
+  //@{
+  /// Greatest lower bound of the domain
+  B glb(void) const {
+    return d_[0];
+  }
+  /// Least upper bound of the domain
+  B lub(void) const {
+    return d_[2*n_-1];
+  }
+  /// Returns the median of the hull of the domain
+  B median(void) const {
+    boost::numeric::interval_lib::rounded_math<B> rnd;
+    return rnd.div_down( rnd.add_down(lub(),glb()) , 2.0);
+  }
+  /// Number of disjoint intervals in the domain
+  int pieces(void) const {
+    return n_;
+  }
+  /// Lower bound of the interval \a i
+  B lo(int i) const {
+    return d_[2*i];
+  }
+  /// Upper bound of the interval \a i
+  B hi(int i) const {
+    return d_[2*i+1];
+  }
+  //@}
+  /// \name Pruning operations
+  //@{
+  /// Prune the values smaller than \a f
+  ModEvent geq(Space& home, B f) {
+    if (!(f <= lub()))
+      return ME_CPFLOAT_FAILED;
+    if (f <= glb() || assigned())
+      return ME_CPFLOAT_NONE;
+    int i = 0;
+    while (d_[2*i+1] < f) i++;
+    B l = glb(), u = lub();
+    if (i > 0) {
+      for (int j=0; j<2*(n_-i); j++)
+        d_[j] = d_[j+2*i];
+      home.free<B>(d_+2*(n_-i),2*i);
+      n_ -= i;
+    }
+    d_[0] = std::max(d_[0],f);
+    return bounds(home,l,u);
+  }
+  /// Prune the values greater than \a f
+  ModEvent leq(Space& home, B f) {
+    if (!(f >= glb()))
+      return ME_CPFLOAT_FAILED;
+    if (f >= lub() || assigned())
+      return ME_CPFLOAT_NONE;
+    int i = n_;
+    while (d_[2*(i-1)] > f) i--;
+    B l = glb(), u = lub();
+    if (i < n_) {
+      home.free<B>(d_+2*i,2*(n_-i));
+      n_ = i;
+    }
+    d_[2*n_-1] = std::min(d_[2*n_-1],f);
+    return bounds(home,l,u);
+  }
+  /**
+   * \brief Intersect the domain with the union of the \a m sorted
+   * disjoint intervals in \a e.
+   *
+   * Interval \a i of \a e is [\a e[2i], \a e[2i+1]], its bounds are
+   * rounded outwards to \a B.
+   */
+  ModEvent inter(Space& home, const BoundType* e, int m) {
+    Gecode::Region r(home);
+    B* t = r.alloc<B>(2*(n_+m));
+    int k = 0;
+    for (int i=0, j=0; i<n_ && j<m; ) {
+      B l = std::max(d_[2*i],BoundTraits<B>::down(e[2*j]));
+      B u = std::min(d_[2*i+1],BoundTraits<B>::up(e[2*j+1]));
+      if (l <= u) {
+        t[2*k] = l; t[2*k+1] = u; k++;
+      }
+      if (d_[2*i+1] < BoundTraits<B>::up(e[2*j+1])) i++; else j++;
+    }
+    if (k == 0)
+      return ME_CPFLOAT_FAILED;
+    if (assigned())
+      return ME_CPFLOAT_NONE;
+    while (k > CPFLOAT_UNION_SIZE) {
+      // merge the two intervals separated by the smallest gap
+      int g = 0;
+      for (int i=1; i<k-1; i++)
+        if (t[2*i+2]-t[2*i+1] < t[2*g+2]-t[2*g+1])
+          g = i;
+      t[2*g+1] = t[2*g+3];
+      for (int i=2*g+2; i<2*k-2; i++)
+        t[i] = t[i+2];
+      k--;
+    }
+    B l = glb(), u = lub();
+    set(home,t,k);
+    return bounds(home,l,u);
+  }
+  //@}
+  /// \name Domain tests
+  //@{
+  /// Tests for assignment of the hull of the domain
+  bool assigned(void) const {
+    return P::within(glb(),lub());
+  }
+  //@}
+  /// \name Subscriptions hadling
+  //@{
+  // subscriptions
+  void subscribe(Space& home, Propagator& p, PropCond pc, bool schedule=true) {
+    CPFloatVarImpBase::subscribe(home,p,pc,assigned(),schedule);
+  }
+  void subscribe(Space& home, Advisor& a) {
+    CPFloatVarImpBase::subscribe(home,a,assigned());
+  }
+  void cancel(Space& home, Propagator& p, PropCond pc) {
+    CPFloatVarImpBase::cancel(home,p,pc,assigned());
+  }
+  void cancel(Space& home, Advisor& a) {
+    CPFloatVarImpBase::cancel(home,a,assigned());
+  }
+  //@}
+  /// \name Copying
+  //@{
+  CPFloatUnionVarImpT(Space& home, bool share, CPFloatUnionVarImpT& y)
+    : CPFloatVarImpBase(home,share,y), P(y), n_(y.n_),
+      d_(home.alloc<B>(2*y.n_)) {
+    for (int i=0; i<2*n_; i++)
+      d_[i] = y.d_[i];
+  }
+
+  CPFloatUnionVarImpT* copy(Space& home, bool share) {
+    if (copied())
+      return static_cast<CPFloatUnionVarImpT*>(forward());
+    else
+      return new (home) CPFloatUnionVarImpT(home,share,*this);
+  }
+  //@}
+  // delta information
+  static BoundType min(const Delta& d) {
+    return static_cast<const CPFloatDelta&>(d).min();
+  }
+  static BoundType max(const Delta& d) {
+    return static_cast<const CPFloatDelta&>(d).max();
+  }
+};
+
+/// Union variable implementation with double bounds
+typedef CPFloatUnionVarImpT<double> CPFloatUnionVarImp;
+
+}}
+
+// union variable
+namespace MPG {
+
+template <class B, class P=CPFloat::VarPrecision<B> >
+class CPFloatUnionVarT : public VarImpVar<CPFloat::CPFloatUnionVarImpT<B,P> > {
+protected:
+  using VarImpVar<CPFloat::CPFloatUnionVarImpT<B,P> >::x;
+public:
+  CPFloatUnionVarT(void) {}
+  CPFloatUnionVarT(const CPFloatUnionVarT& y)
+    : VarImpVar<CPFloat::CPFloatUnionVarImpT<B,P> >(y.varimp()) {}
+  CPFloatUnionVarT(CPFloat::CPFloatUnionVarImpT<B,P> *y)
+    : VarImpVar<CPFloat::CPFloatUnionVarImpT<B,P> >(y) {}
+
+  // variable creation
+  CPFloatUnionVarT(Space& home, B l, B u, const P& precision=P())
+    : VarImpVar<CPFloat::CPFloatUnionVarImpT<B,P> >
+      (new (home) CPFloat::CPFloatUnionVarImpT<B,P>(home,l,u,precision)) {
+    if (l > u)
+      throw CPFloat::VariableEmptyDomain("CPFloatUnionVar::CPFloatUnionVar");
+  }
+  /// \name Domain information
+  //@{
+  /// Greatest lower bound of the domain
+  B glb(void) const {
+    return x->glb();
+  }
+  /// Least upper bound of the domain
+  B lub(void) const {
+    return x->lub();
+  }
+  /// Number of disjoint intervals in the domain
+  int pieces(void) const {
+    return x->pieces();
+  }
+  /// Lower bound of the interval \a i
+  B lo(int i) const {
+    return x->lo(i);
+  }
+  /// Upper bound of the interval \a i
+  B hi(int i) const {
+    return x->hi(i);
+  }
+  //@}
+};
+
+/// Union variable with double bounds
+typedef CPFloatUnionVarT<double> CPFloatUnionVar;
+
+template<class Char, class Traits, class B, class P>
+std::basic_ostream<Char,Traits>&
+operator <<(std::basic_ostream<Char,Traits>& os, const CPFloatUnionVarT<B,P>& x) {
+  std::basic_ostringstream<Char,Traits> s;
+  s.copyfmt(os); s.width(0);
+
+  for (int i=0; i<x.pieces(); i++)
+    s << (i > 0 ? " u " : "") << "{" << x.lo(i) << " , " << x.hi(i) << "}";
+
+  if (x.assigned()) s << " * ";
+
+  return os << s.str();
+}
+
+}
+
+// union view
+namespace MPG { namespace CPFloat {
+/**
+ * \brief View for union variables with bounds of type \a B
+ *
+ * Provides the interface of CPFloatViewT, so that the bound
+ * propagators can be used on union variables, plus the access to the
+ * intervals of the domain.
+ */
+template <class B, class P=VarPrecision<B> >
+class CPFloatUnionViewT : public VarImpView<CPFloatUnionVarT<B,P> > {
+protected:
+  using VarImpView<CPFloatUnionVarT<B,P> >::x;
+public:
+  CPFloatUnionViewT(void) {}
+  CPFloatUnionViewT(const CPFloatUnionVarT<B,P>& y)
+    : VarImpView<CPFloatUnionVarT<B,P> >(y.varimp()) {}
+  CPFloatUnionViewT(CPFloatUnionVarImpT<B,P>* y)
+    : VarImpView<CPFloatUnionVarT<B,P> >(y) {}
+  // access operations
+  BoundType glb(void) const {
+    return x->glb();
+  }
+  BoundType lub(void) const {
+    return x->lub();
+  }
+  BoundType median(void) const {
+    return x->median();
+  }
+  int pieces(void) const {
+    return x->pieces();
+  }
+  BoundType lo(int i) const {
+    return x->lo(i);
+  }
+  BoundType hi(int i) const {
+    return x->hi(i);
+  }
+
+  // modification operations
+  ModEvent geq(Space& home, BoundType f) {
+    return x->geq(home,BoundTraits<B>::down(f));
+  }
+  ModEvent leq(Space& home, BoundType f) {
+    return x->leq(home,BoundTraits<B>::up(f));
+  }
+  ModEvent narrow(Space& home, BoundType l, BoundType u) {
+    BoundType e[2] = {l, u};
+    return x->inter(home,e,1);
+  }
+  ModEvent inter(Space& home, const BoundType* e, int m) {
+    return x->inter(home,e,m);
+  }
+  // delta information
+  BoundType min(const Delta& d) const {
+    return CPFloatUnionVarImpT<B,P>::min(d);
+  }
+  BoundType max(const Delta& d) const {
+    return CPFloatUnionVarImpT<B,P>::max(d);
+  }
+  bool operator==(CPFloatUnionViewT v) {
+    return (x == v.x);
+  }
+};
+
+/// View on union variables with double bounds
+typedef CPFloatUnionViewT<double> CPFloatUnionView;
+
+}}
+
+namespace MPG {
+
+  template <class B, class P>
+  void branch(Gecode::Home home, CPFloatUnionVarT<B,P> x);
+  template <class B, class P>
+  void equality(Gecode::Space& home, CPFloatUnionVarT<B,P> x, CPFloatVarT<B,P> y);
+  template <class B, class P>
+  void power(Gecode::Space& home, CPFloatUnionVarT<B,P> x, int e, CPFloatVarT<B,P> y);
+
+}
+
+#endif
@@ -24,7 +24,7 @@
 /* #include <ieeefp.h> */
 #include "smath.h"
 
-static int debug = 0;
+static const int debug = 0;
 
 #if BYTE_ORDER == BIG_ENDIAN
 static NEWDOUBLE
@@ -16,13 +16,19 @@
 
 2003-03-11  changed __BYTE_ORDER to BYTE_ORDER for portability      dkw
 2003-12-12  removed some includes, as they're in smath.h           dkw
+2026-10-19  expII and logII evaluate both endpoints in one paired
+            kernel (see IApair.h), added expII_batch and logII_batch
+2026-10-20  logDI and logII no longer range reduce subnormal numbers,
+            which read outside of log_tab
 
 */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <float.h>
 /* #include <ieeefp.h> */
 #include "smath.h"
+#include "IApair.h"
 
 #if BYTE_ORDER == BIG_ENDIAN
 static NEWDOUBLE
@@ -267,16 +273,104 @@ INTERVAL expDI(double x) {
 
 
 
-INTERVAL expII(INTERVAL X) {
-  INTERVAL Y,T;
-  T = expDI(X.lo);
-  Y.lo = T.lo;
-  T = expDI(X.hi);
-  Y.hi = T.hi;
+   /*
+   ****************************************************************
+   This is expDI on both endpoints of X at once: lane 0 holds X.lo,
+   lane 1 holds X.hi, and they share the range reduction and the
+   Taylor series. The rounding mode must be toward minus infinity.
+   ****************************************************************
+   */
+static INTERVAL exp_pair_dn(INTERVAL X) {
+  double x[PAIR],n[PAIR],t[PAIR];
+  INTERVAL P,Y;
+  INTERVAL_PAIR A,B,R,T;
+  int i,k,deg=15;
+
+  x[0] = X.lo;
+  x[1] = X.hi;
+
+    /* RANGE REDUCTION, out of range lanes are patched at the end */
+  for(k=0;k<PAIR;k++) {
+    x[k] = pair_min(pair_max(x[k],LOGMINREAL.d),LOGMAXREAL.d);
+    n[k] = floor(x[k]/LN2_LO.d+0.5);
+  }
+    /* A = (x-n*ln2a) - n*ln2B */
+  for(k=0;k<PAIR;k++) {
+    A.lo[k] = SUB_0(x[k],MUL_1(n[k],LN2_A.d));
+    A.hi[k] = SUB_1(x[k],MUL_0(n[k],LN2_A.d));
+    T.lo[k] = LN2B.i.lo;
+    T.hi[k] = LN2B.i.hi;
+  }
+  pair_cnst(n,&B);
+  pair_mul(&B,&T,&B);
+  pair_sub(&A,&B,&A);
+
+    /* TAYLOR SERIES EVALUATION of exp(A) */
+  for(k=0;k<PAIR;k++) { R.lo[k] = 0.5; R.hi[k] = 2; }
+  for(i=deg;i>=3;i--) {
+    pair_mul(&A,&R,&R);
+    pair_divC(&R,i);
+    pair_addD(1.0,&R);
+  }
+  pair_mul(&A,&R,&T);
+  pair_mul(&A,&T,&T);
+  pair_divC(&T,2.0);
+  pair_add(&A,&T,&T);
+  pair_addD(1.0,&T);
+
+    /* APPLY ADDITION LAW : exp(x) = exp(a+n*ln(2)) = R*2^n */
+  for(k=0;k<PAIR;k++) {
+    P = two_to_nDI(n[k]);
+    B.lo[k] = P.lo;
+    B.hi[k] = P.hi;
+  }
+  pair_mul(&T,&B,&R);
+
+  Y.lo = R.lo[0];
+  Y.hi = R.hi[1];
+  for(k=0,t[0]=X.lo,t[1]=X.hi;k<PAIR;k++) {
+    if (t[k] > LOGMAXREAL.d) P = NEAR_POS_INF.i;
+    else if (t[k] < LOGMINREAL.d) P = NEAR_POS_ZERO.i;
+    else continue;
+    if (k==0) Y.lo = P.lo; else Y.hi = P.hi;
+  }
   return(Y);
 }
 
 
+INTERVAL expII(INTERVAL X) {
+  volatile INTERVAL V;
+
+  V = X;
+  {
+    pair_rounddn;
+    V = exp_pair_dn(V);
+    pair_roundrs;
+  }
+  return(V);
+}
+
+
+   /*
+   ****************************************************************
+   Y[i] = exp(X[i]) for i=0..n-1, with one rounding mode switch for
+   the whole batch.
+   ****************************************************************
+   */
+void expII_batch(const INTERVAL *X, INTERVAL *Y, int n) {
+  volatile INTERVAL V;
+  int i;
+  pair_rounddn;
+
+  for(i=0;i<n;i++) {
+    V = X[i];
+    V = exp_pair_dn(V);
+    Y[i] = V;
+  }
+  pair_roundrs;
+}
+
+
 
 
 
@@ -400,6 +494,8 @@ INTERVAL logDI(double x) {
 
   if (x==POS_INF.d) return(NEAR_POS_INF.i);
   if (x==0.0) return(NEAR_NEG_INF.i);
+    /* get_bits_exp is not exact below the normal range */
+  if (x<DBL_MIN) return(makeDDI(NEAR_NEG_INF.i.lo,logDI(DBL_MIN).hi));
 
   get_bits_exp(x,&a,&n);
   i = floor(a*8)-8;
@@ -427,18 +523,125 @@ INTERVAL logDI(double x) {
 
 
 
+   /*
+   ****************************************************************
+   This is logDI on both endpoints of X at once (0 <= X.lo), with
+   lane 0 holding X.lo and lane 1 holding X.hi. The rounding mode
+   must be toward minus infinity.
+   ****************************************************************
+   */
+static INTERVAL log_pair_dn(INTERVAL X) {
+  double x[PAIR],a[PAIR],d[PAIR],fn[PAIR];
+  int n[PAIR],i[PAIR];
+  int j,k,deg=40;
+  INTERVAL Y,P;
+  INTERVAL_PAIR A1,R,T,S;
+
+  x[0] = X.lo;
+  x[1] = X.hi;
+
+    /* Range reduction to [1, 1+1/8], 0 and inf are patched at the end.
+       get_bits_exp is not exact below the normal range: a subnormal
+       lower bound is patched like 0, an upper one is raised to DBL_MIN */
+  for(k=0;k<PAIR;k++) {
+    if ((x[k]==POS_INF.d) || (x[k]==0.0)) x[k] = 1.0;
+    else if (x[k]<DBL_MIN) x[k] = (k==0) ? 1.0 : DBL_MIN;
+    get_bits_exp(x[k],a+k,n+k);
+    i[k] = floor(a[k]*8)-8;
+    if (i[k] <= 1) i[k] = 0;
+    d[k] = 1+i[k]/8.0;
+    fn[k] = n[k];
+  }
+  for(k=0;k<PAIR;k++) {
+    A1.lo[k] = SUB_0(a[k],d[k]);
+    A1.hi[k] = SUB_1(a[k],d[k]);
+  }
+  pair_divD(&A1,d);
+
+    /* Taylor evaluation of log(1+A1) */
+  for(k=0;k<PAIR;k++) { R.lo[k] = 0; R.hi[k] = 1; }
+  for (j=deg;j>=2;j--) {
+    pair_mul(&A1,&R,&T);
+    for(k=0;k<PAIR;k++) {
+      R.lo[k] = SUB_0(DIV_0(1.0,j),T.hi[k]);
+      R.hi[k] = SUB_1(DIV_1(1.0,j),T.lo[k]);
+    }
+  }
+  pair_mul(&A1,&R,&T);
+  pair_mul(&A1,&T,&T);
+  pair_sub(&A1,&T,&R);
+
+    /* Use addition law: 
+       ln((1+a1)*(1+A1)*2^n) = ln(1+a1)+ln(1+A1)+n*ln(2) */
+  for(k=0;k<PAIR;k++) {
+    T.lo[k] = LN2B.i.lo;
+    T.hi[k] = LN2B.i.hi;
+  }
+  pair_cnst(fn,&S);
+  pair_mul(&S,&T,&S);
+  for(k=0;k<PAIR;k++) {
+    T.lo[k] = log_tab[i[k]].b.i.lo;
+    T.hi[k] = log_tab[i[k]].b.i.hi;
+  }
+  pair_add(&S,&T,&S);
+  pair_add(&R,&S,&S);
+  for(k=0;k<PAIR;k++) {
+    T.lo[k] = ADD_0(log_tab[i[k]].a.d,S.lo[k]);
+    T.hi[k] = ADD_1(log_tab[i[k]].a.d,S.hi[k]);
+    R.lo[k] = MUL_0(fn[k],LN2_A.d);
+    R.hi[k] = MUL_1(fn[k],LN2_A.d);
+  }
+  pair_add(&R,&T,&R);
+
+  Y.lo = R.lo[0];
+  Y.hi = R.hi[1];
+  for(k=0,x[0]=X.lo,x[1]=X.hi;k<PAIR;k++) {
+    if (x[k]==POS_INF.d) P = NEAR_POS_INF.i;
+    else if ((x[k]==0.0) || ((k==0) && (x[k]<DBL_MIN))) P = NEAR_NEG_INF.i;
+    else continue;
+    if (k==0) Y.lo = P.lo; else Y.hi = P.hi;
+  }
+  return(Y);
+}
+
+
 INTERVAL logII(INTERVAL X) {
-  INTERVAL T,Y;
+  volatile INTERVAL V;
   if (X.hi < 0) return(FAIL_INT.i);
   if (X.lo < 0) X.lo = 0;
-  T = logDI(X.lo);
-  Y.lo = T.lo;
-  T = logDI(X.hi);
-  Y.hi = T.hi;
-  return(Y);
+
+  V = X;
+  {
+    pair_rounddn;
+    V = log_pair_dn(V);
+    pair_roundrs;
+  }
+  return(V);
 }  
 
 
+   /*
+   ****************************************************************
+   Y[i] = log(X[i]) for i=0..n-1, with one rounding mode switch for
+   the whole batch.
+   ****************************************************************
+   */
+void logII_batch(const INTERVAL *X, INTERVAL *Y, int n) {
+  volatile INTERVAL V;
+  int i;
+  pair_rounddn;
+
+  for(i=0;i<n;i++) {
+    if (X[i].hi < 0) { Y[i] = FAIL_INT.i; continue; }
+    V = X[i];
+    if (V.lo < 0) V.lo = 0;
+    V = log_pair_dn(V);
+    Y[i] = V;
+  }
+  pair_roundrs;
+}
+
+
 /*
 void narrow_expII(INTERVAL *X,INTERVAL *Y) {
   *Y = intersectIII(*Y,expII(*X));
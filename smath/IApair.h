@@ -0,0 +1,122 @@
+/*
+  IApair.h
+
+  Two-lane interval arithmetic for the paired endpoint kernels
+  (expII, logII, sinII, cosII and their batch versions).
+
+  Each lane holds one interval [lo[k],hi[k]]. The operations below
+  assume that the rounding mode is toward minus infinity, so that
+  lower bounds are computed with OP_0 and upper bounds with OP_1
+  (see smath.h). A kernel switches the rounding mode once on entry
+  and once on exit instead of twice for every sound operation, and
+  the loops over the lanes have no branches so the compiler can map
+  them onto SIMD registers (SSE/NEON honour the same rounding mode).
+
+  Only positive divisors are supported, and products are taken as
+  the min/max of the four endpoint products, which agrees with
+  interval_mul4 on finite operands.
+
+  The smath sources must be compiled with -frounding-math (gcc) so
+  that OP_1 is not folded back into OP_0.
+*/
+
+#ifndef IAPAIR_H
+#define IAPAIR_H
+
+#include <fenv.h>
+
+#define PAIR 2
+
+typedef struct interval_pair {
+  double lo[PAIR];
+  double hi[PAIR];
+} INTERVAL_PAIR;
+
+/* Enter and leave round toward minus infinity. Inputs of a kernel
+   should be read, and its results written, through volatile
+   variables between these two so that no operation is moved across
+   the mode switch. */
+#define pair_rounddn   int pair_rnd_mode_ = fegetround(); fesetround(FE_DOWNWARD);
+#define pair_roundrs   fesetround(pair_rnd_mode_);
+
+static inline double pair_min(double a, double b) { return((a<b)?a:b); }
+static inline double pair_max(double a, double b) { return((a>b)?a:b); }
+
+/* z = [a,a] */
+static inline void pair_cnst(const double a[PAIR], INTERVAL_PAIR *z) {
+  int k;
+  for(k=0;k<PAIR;k++) { z->lo[k] = a[k]; z->hi[k] = a[k]; }
+}
+
+/* z = x + y */
+static inline void pair_add(const INTERVAL_PAIR *x, const INTERVAL_PAIR *y,
+                            INTERVAL_PAIR *z) {
+  int k;
+  for(k=0;k<PAIR;k++) {
+    z->lo[k] = ADD_0(x->lo[k],y->lo[k]);
+    z->hi[k] = ADD_1(x->hi[k],y->hi[k]);
+  }
+}
+
+/* z = x - y */
+static inline void pair_sub(const INTERVAL_PAIR *x, const INTERVAL_PAIR *y,
+                            INTERVAL_PAIR *z) {
+  int k;
+  double lo;
+  for(k=0;k<PAIR;k++) {
+    lo       = SUB_0(x->lo[k],y->hi[k]);
+    z->hi[k] = SUB_1(x->hi[k],y->lo[k]);
+    z->lo[k] = lo;
+  }
+}
+
+/* z = a + z */
+static inline void pair_addD(double a, INTERVAL_PAIR *z) {
+  int k;
+  for(k=0;k<PAIR;k++) {
+    z->lo[k] = ADD_0(a,z->lo[k]);
+    z->hi[k] = ADD_1(a,z->hi[k]);
+  }
+}
+
+/* z = -z */
+static inline void pair_neg(INTERVAL_PAIR *z) {
+  int k;
+  double t;
+  for(k=0;k<PAIR;k++) { t = z->lo[k]; z->lo[k] = -z->hi[k]; z->hi[k] = -t; }
+}
+
+/* z = x * y */
+static inline void pair_mul(const INTERVAL_PAIR *x, const INTERVAL_PAIR *y,
+                            INTERVAL_PAIR *z) {
+  int k;
+  double lo,hi;
+  for(k=0;k<PAIR;k++) {
+    lo = pair_min(pair_min(MUL_0(x->lo[k],y->lo[k]),MUL_0(x->lo[k],y->hi[k])),
+                  pair_min(MUL_0(x->hi[k],y->lo[k]),MUL_0(x->hi[k],y->hi[k])));
+    hi = pair_max(pair_max(MUL_1(x->lo[k],y->lo[k]),MUL_1(x->lo[k],y->hi[k])),
+                  pair_max(MUL_1(x->hi[k],y->lo[k]),MUL_1(x->hi[k],y->hi[k])));
+    z->lo[k] = lo;
+    z->hi[k] = hi;
+  }
+}
+
+/* z = z / d[k], d[k] > 0 */
+static inline void pair_divD(INTERVAL_PAIR *z, const double d[PAIR]) {
+  int k;
+  for(k=0;k<PAIR;k++) {
+    z->lo[k] = DIV_0(z->lo[k],d[k]);
+    z->hi[k] = DIV_1(z->hi[k],d[k]);
+  }
+}
+
+/* z = z / d, d > 0 */
+static inline void pair_divC(INTERVAL_PAIR *z, double d) {
+  int k;
+  for(k=0;k<PAIR;k++) {
+    z->lo[k] = DIV_0(z->lo[k],d);
+    z->hi[k] = DIV_1(z->hi[k],d);
+  }
+}
+
+#endif
@@ -15,6 +15,8 @@
 
 2003-03-11  changed __BYTE_ORDER to BYTE_ORDER for portability      dkw
 2003-12-12  removed include math.h, as it's in smath                dkw
+2026-10-19  added sincos0_pairDI, sin0DI/cos0DI on two arguments in
+            one paired kernel (see IApair.h)
 
 */
 
@@ -23,8 +25,9 @@
 #include <stdlib.h>
 /* #include <ieeefp.h> */
 #include "smath.h"
+#include "IApair.h"
 
-static int debug = 0;
+static const int debug = 0;
 
 #if BYTE_ORDER == BIG_ENDIAN
 static NEWDOUBLE
@@ -331,6 +334,119 @@ INTERVAL tan0DI(double x) {
 
 
 
+   /*
+   ****************************************************************
+   This is sin0DI(x[k]) (is_cos[k]==0) or cos0DI(x[k]) (is_cos[k]!=0)
+   on both lanes at once. The lanes share the reduction to [0,pi/4]
+   and one pass through the polynomials of sin_hot and cos_hot,
+   whose coefficients are selected per lane. The rounding mode must
+   be toward minus infinity.
+   ****************************************************************
+   */
+static void sincos0_pair_dn(const double x[PAIR], const int is_cos[PAIR],
+                            INTERVAL y[PAIR]) {
+  double a[PAIR],d1[PAIR],d2[PAIR],t;
+  int c[PAIR],neg[PAIR];
+  int j,k;
+  INTERVAL_PAIR W,A,A2,a2,W2,R,S,C,T;
+
+  for(k=0;k<PAIR;k++) {
+    t = fabs(x[k]);
+    neg[k] = (!is_cos[k]) && (x[k] < 0);
+    if (t <= 0.125*TWOPI.i.hi) {
+      a[k] = t;
+      W.lo[k] = W.hi[k] = 0;
+      c[k] = is_cos[k];
+    }
+    else {
+      /* t = a + W - pi/2, swap sin and cos */
+      a[k] = SUB_0(PIOVER2.i.hi,t);
+      W.lo[k] = ADD_0(SUB_0(SUB_0(PI_OVER_2_A.d,t),a[k]),PIOVER2B.i.lo);
+      W.hi[k] = ADD_1(SUB_1(SUB_1(PI_OVER_2_A.d,t),a[k]),PIOVER2B.i.hi);
+      c[k] = !is_cos[k];
+    }
+  }
+
+    /* A = a+W, A2 = a2 + W2 = a^2 + W*(W+2a) */
+  for(k=0;k<PAIR;k++) {
+    A.lo[k]  = ADD_0(a[k],W.lo[k]);
+    A.hi[k]  = ADD_1(a[k],W.hi[k]);
+    a2.lo[k] = MUL_0(a[k],a[k]);
+    a2.hi[k] = MUL_1(a[k],a[k]);
+    T.lo[k]  = ADD_0(W.lo[k],2*a[k]);
+    T.hi[k]  = ADD_1(W.hi[k],2*a[k]);
+  }
+  pair_mul(&W,&T,&W2);
+  pair_add(&a2,&W2,&A2);
+
+    /* sin_hot(A2) or cos_hot(A2) */
+  for(k=0;k<PAIR;k++) { R.lo[k] = -1; R.hi[k] = 1; }
+  for (j=20;j>=8;j -= 4) {
+    for(k=0;k<PAIR;k++) {
+      d1[k] = c[k] ? (j-1)*j     : (j+1)*j;
+      d2[k] = c[k] ? (j-3)*(j-2) : (j-1)*(j-2);
+    }
+    pair_mul(&A2,&R,&R);
+    pair_divD(&R,d1);
+    pair_addD(-1.0,&R);
+    pair_mul(&A2,&R,&R);
+    pair_divD(&R,d2);
+    pair_addD( 1.0,&R);
+  }
+
+    /* sin0: a + (W + A*(A2*sin_hot(A2))/6) */
+  pair_mul(&A2,&R,&S);
+  pair_divC(&S,20.0);
+  pair_addD(-1.0,&S);
+  pair_mul(&A2,&S,&S);
+  pair_mul(&A,&S,&S);
+  pair_divC(&S,6.0);
+  pair_add(&W,&S,&S);
+  for(k=0;k<PAIR;k++) {
+    S.lo[k] = ADD_0(a[k],S.lo[k]);
+    S.hi[k] = ADD_1(a[k],S.hi[k]);
+  }
+
+    /* cos0: 1 + (-a2/2 + (-W2/2 + A2*A2*cos_hot(A2)/24)) */
+  pair_mul(&A2,&A2,&C);
+  pair_mul(&C,&R,&C);
+  pair_divC(&C,24.0);
+  pair_neg(&W2);
+  pair_divC(&W2,2.0);
+  pair_add(&W2,&C,&C);
+  pair_divC(&a2,2.0);
+  pair_neg(&a2);
+  pair_add(&a2,&C,&C);
+  pair_addD(1.0,&C);
+
+  for(k=0;k<PAIR;k++) {
+    y[k].lo = c[k] ? C.lo[k] : S.lo[k];
+    y[k].hi = c[k] ? C.hi[k] : S.hi[k];
+    if (neg[k]) y[k] = makeDDI(-y[k].hi,-y[k].lo);
+  }
+}
+
+
+void sincos0_pairDI(const double x[2], const int is_cos[2], INTERVAL y[2]) {
+  volatile double vx[PAIR];
+  volatile INTERVAL vy[PAIR];
+  double lx[PAIR];
+  INTERVAL ly[PAIR];
+  int k;
+
+  for(k=0;k<PAIR;k++) vx[k] = x[k];
+  {
+    pair_rounddn;
+    for(k=0;k<PAIR;k++) lx[k] = vx[k];
+    sincos0_pair_dn(lx,is_cos,ly);
+    for(k=0;k<PAIR;k++) vy[k] = ly[k];
+    pair_roundrs;
+  }
+  for(k=0;k<PAIR;k++) y[k] = vy[k];
+}
+
+
+
 INTERVAL sin2pi0DI(double x) {
 /*
   Let x*2pi = y+W,  (1/4-x)*2pi = z+U
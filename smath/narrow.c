@@ -40,8 +40,6 @@
     //NEG_INF       = {{0x0000,0x0000, 0x0000, 0xfff0 }};
 //#endif
 
-int FAIL_FLAG=0;
-
 #define MAX(x,y) (((x)>(y))?(x):(y))
 #define MIN(x,y) (((x)<(y))?(x):(y))
 
@@ -43,8 +43,6 @@ static NEWDOUBLE
     NEG_INF       = {{0x0000,0x0000, 0x0000, 0xfff0 }};
 #endif
 
-extern int FAIL_FLAG;
-
 int interval_mul(double x1, double x2, double y1, double y2, double* low, double* high);
 int interval_div(double x1, double x2, double y1, double y2, double* low, double* high);
 int interval_div4(double x1, double x2, double y1, double y2, double* low, double* high);
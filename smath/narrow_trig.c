@@ -129,6 +129,18 @@ static void new_print_interval(char *s, INTERVAL p) {
   printf("\n");
 }
 
+static INTERVAL periodic_reducedII(const TRIG_REDUCTION *Rlo,
+                                   const TRIG_REDUCTION *Rhi,
+                                   INTERVAL (*range)(), double (*f)(),
+                                   void (*fpair)(),
+                                   INTERVAL Y, int K);
+static int intersect_inv_periodic_reducedII(INTERVAL Z, INTERVAL *X,
+                                            const TRIG_REDUCTION *Rlo,
+                                            const TRIG_REDUCTION *Rhi,
+                                            int (*inv_f)(),
+                                            double (*translate)(),
+                                            INTERVAL Y, int K);
+
 
    /*
    ****************************************************************
@@ -222,9 +234,7 @@ INTERVAL periodicfnII(
          INTERVAL Y,
               int K
 ) {
-
-  int Jlo,Jhi,mlo,mhi,width;
-  double Nlo,Nhi,Zlo,Zhi,y1,y2;
+  TRIG_REDUCTION Rlo,Rhi;
   int debug=0;
 
   if (debug) {
@@ -232,31 +242,63 @@ INTERVAL periodicfnII(
     print_interval("Y :",Y); 
   }
 
-  if (!(reduce(0, X.lo, &Nlo, &Jlo, &Zlo) 
-         &&
-        reduce(1, X.hi, &Nhi, &Jhi, &Zhi)))
+  Rlo.ok = reduce(0, X.lo, &Rlo.N, &Rlo.J, &Rlo.Z);
+  Rhi.ok = reduce(1, X.hi, &Rhi.N, &Rhi.J, &Rhi.Z);
+
+  return(periodic_reducedII(&Rlo,&Rhi,range,f,NULL,Y,K));
+}
+
+
+   /*
+   ****************************************************************
+   This is periodicfnII once both endpoints of X have been reduced,
+   it allows several periodic functions of the same argument
+   (e.g. sin and cos) to share one range reduction.
+   If fpair is not NULL, fpair(Jlo,Zlo,Jhi,Zhi,&y1,&y2) computes
+   y1 = f(0,Jlo,Zlo) and y2 = f(1,Jhi,Zhi) in one call.
+   ****************************************************************
+   */
+static INTERVAL periodic_reducedII(
+   const TRIG_REDUCTION *Rlo,
+   const TRIG_REDUCTION *Rhi,
+         INTERVAL (*range)(),
+           double (*f)(), 
+             void (*fpair)(),
+         INTERVAL Y,
+              int K
+) {
+
+  int mlo,mhi,width;
+  double y1,y2;
+  int debug=0;
+
+  if (!(Rlo->ok && Rhi->ok))
     return(Y);
 
-  mlo = (Zlo>=0)?Jlo:Jlo-1;
-  mhi = (Zhi<=0)?Jhi:Jhi+1;
+  mlo = (Rlo->Z>=0)?Rlo->J:Rlo->J-1;
+  mhi = (Rhi->Z<=0)?Rhi->J:Rhi->J+1;
 
-  width = (mhi- mlo+K*(Nhi-Nlo));
+  width = (mhi- mlo+K*(Rhi->N-Rlo->N));
   if (width > K) return(Y);
 
-  y1 = f(0,Jlo,Zlo);
-  y2 = f(1,Jhi,Zhi);
+  if (fpair)
+    fpair(Rlo->J,Rlo->Z,Rhi->J,Rhi->Z,&y1,&y2);
+  else {
+    y1 = f(0,Rlo->J,Rlo->Z);
+    y2 = f(1,Rhi->J,Rhi->Z);
+  }
 
   Y = unionDDI(y1,y2);
 
   if (debug) {
-    new_print_double("Nlo",Nlo);
-    new_print_double("Jlo",Jlo*1.0);
-    new_print_double("Zlo",Zlo);
+    new_print_double("Nlo",Rlo->N);
+    new_print_double("Jlo",Rlo->J*1.0);
+    new_print_double("Zlo",Rlo->Z);
     new_print_double("mlo",mlo*1.0);
 
-    new_print_double("Nhi",Nhi);
-    new_print_double("Jhi",Jhi*1.0);
-    new_print_double("Zhi",Zhi);
+    new_print_double("Nhi",Rhi->N);
+    new_print_double("Jhi",Rhi->J*1.0);
+    new_print_double("Zhi",Rhi->Z);
     new_print_double("mhi",mhi*1.0);
 
     print_interval("new Y :",Y); 
@@ -572,6 +614,45 @@ double eval_cos(int hilo, int j, double x) {
 }
 
 
+   /*
+   ****************************************************************
+   void eval_sin_pair(int J1, double Z1, int J2, double Z2,
+                      double *y1, double *y2)
+
+   *y1 = eval_sin(0,J1,Z1) and *y2 = eval_sin(1,J2,Z2), with both
+   evaluations done in one call to sincos0_pairDI.
+   ****************************************************************
+   */
+static void eval_sin_pair(int J1, double Z1, int J2, double Z2,
+                          double *y1, double *y2) {
+  int j[2],h[2],c[2],hi[2],inf[2],k;
+  double z[2],v[2];
+  INTERVAL Y[2];
+
+  j[0] = J1; z[0] = Z1; h[0] = 0;
+  j[1] = J2; z[1] = Z2; h[1] = 1;
+  for(k=0;k<2;k++) {
+    c[k]   = j[k]%2;
+    hi[k]  = c[k] ? (h[k] == (z[k]<0)) : h[k];
+    inf[k] = (z[k]==POS_INF.d) || (z[k]==NEG_INF.d);
+    if (inf[k]) z[k] = 0;
+  }
+  sincos0_pairDI(z,c,Y);
+  for(k=0;k<2;k++) {
+    if (inf[k]) v[k] = hi[k] ? 1.0 : -1.0;
+    else        v[k] = hi[k] ? Y[k].hi : Y[k].lo;
+    if (j[k] >= 2) v[k] = -v[k];
+  }
+  *y1 = v[0];
+  *y2 = v[1];
+}
+
+static void eval_cos_pair(int J1, double Z1, int J2, double Z2,
+                          double *y1, double *y2) {
+  eval_sin_pair((J1+1)%4,Z1,(J2+1)%4,Z2,y1,y2);
+}
+
+
 
    /*
    ****************************************************************
@@ -858,12 +939,32 @@ INTERVAL tan2piII(INTERVAL x) {
 
 
 INTERVAL sinII(INTERVAL x) {
-  return(periodicfnII(x,reduce_trig,range_sin,eval_sin,makeDDI(-1,1),4));
+  TRIG_REDUCTION Rlo,Rhi;
+
+  Rlo.ok = reduce_trig(0, x.lo, &Rlo.N, &Rlo.J, &Rlo.Z);
+  Rhi.ok = reduce_trig(1, x.hi, &Rhi.N, &Rhi.J, &Rhi.Z);
+  return(periodic_reducedII(&Rlo,&Rhi,range_sin,eval_sin,eval_sin_pair,makeDDI(-1,1),4));
 }
 
 
 INTERVAL cosII(INTERVAL x) {
-  return(periodicfnII(x,reduce_trig,range_cos,eval_cos,makeDDI(-1,1),4));
+  TRIG_REDUCTION Rlo,Rhi;
+
+  Rlo.ok = reduce_trig(0, x.lo, &Rlo.N, &Rlo.J, &Rlo.Z);
+  Rhi.ok = reduce_trig(1, x.hi, &Rhi.N, &Rhi.J, &Rhi.Z);
+  return(periodic_reducedII(&Rlo,&Rhi,range_cos,eval_cos,eval_cos_pair,makeDDI(-1,1),4));
+}
+
+
+void sinII_batch(const INTERVAL *X, INTERVAL *Y, int n) {
+  int i;
+  for(i=0;i<n;i++) Y[i] = sinII(X[i]);
+}
+
+
+void cosII_batch(const INTERVAL *X, INTERVAL *Y, int n) {
+  int i;
+  for(i=0;i<n;i++) Y[i] = cosII(X[i]);
 }
 
 
@@ -944,12 +1045,37 @@ int intersect_inv_periodicfnII(
            double (*translate)(),
          INTERVAL Y,
               int K
+) {
+  TRIG_REDUCTION Rlo,Rhi;
+
+  Rlo.ok = reduce(0, X->lo, &Rlo.N, &Rlo.J, &Rlo.Z);
+  Rhi.ok = reduce(1, X->hi, &Rhi.N, &Rhi.J, &Rhi.Z);
+
+  return(intersect_inv_periodic_reducedII(Z,X,&Rlo,&Rhi,inv_f,translate,Y,K));
+}
+
+
+/*
+  This is intersect_inv_periodicfnII once both endpoints of X have
+  been reduced. The reductions stay valid (but may give a weaker
+  narrowing) if X has been narrowed since they were computed, so
+  several inverses can be applied to X from a single reduction.
+*/
+
+static int intersect_inv_periodic_reducedII(
+         INTERVAL Z, 
+         INTERVAL *X, 
+   const TRIG_REDUCTION *Rlo,
+   const TRIG_REDUCTION *Rhi,
+              int (*inv_f)(), 
+           double (*translate)(),
+         INTERVAL Y,
+              int K
 ) {
   int i,j,k; //,s;
   int nonempty[32];
   INTERVAL W[32];
-  double tmp,Nlo,Nhi,XXlo,XXhi;
-  int Jlo,Jhi;
+  double tmp;
 
   if ((Y.hi < Z.lo) || (Z.hi < Y.lo))
     return(FAIL);
@@ -960,13 +1086,13 @@ int intersect_inv_periodicfnII(
    
 
   /* narrow X->lo */
-  if (reduce(0, X->lo, &Nlo, &Jlo, &XXlo)) {
+  if (Rlo->ok) {
      for(j=0;j<2*K;j++) {
-        i = j/2; /*s = j % 2*/; k = (j + 2*Jlo)%(2*K); 
+        i = j/2; /*s = j % 2*/; k = (j + 2*Rlo->J)%(2*K); 
         if (nonempty[k]) {  /* (inv_f((i+Jlo)%K,s,Z,&W)) {*/
-           if (X->lo < (tmp = translate(0,Nlo,Jlo+i,W[k].lo))) 
+           if (X->lo < (tmp = translate(0,Rlo->N,Rlo->J+i,W[k].lo))) 
               {X->lo = tmp;  break;}
-           else if (X->lo <= (tmp = translate(1,Nlo,Jlo+i,W[k].hi))) {
+           else if (X->lo <= (tmp = translate(1,Rlo->N,Rlo->J+i,W[k].hi))) {
                break;}
 	 }
      }
@@ -974,13 +1100,13 @@ int intersect_inv_periodicfnII(
      }
 
   /* narrow X->hi */
-  if (reduce(1, X->hi, &Nhi, &Jhi, &XXhi)) {
+  if (Rhi->ok) {
      for(j=0;j<2*K;j++) {
-        i=j/2; /*s= 1-(j%2)*/; k = (2*Jhi+1-j+2*K)%(2*K); 
+        i=j/2; /*s= 1-(j%2)*/; k = (2*Rhi->J+1-j+2*K)%(2*K); 
         if (nonempty[k]) {  /* inv_f((Jhi+K-i)%K,s,Z,&W)) {*/
-           if (X->hi > (tmp = translate(1,Nhi,Jhi-i,W[k].hi))) 
+           if (X->hi > (tmp = translate(1,Rhi->N,Rhi->J-i,W[k].hi))) 
               {X->hi = tmp;   break;}
-           else if (X->hi >= (tmp = translate(0,Nhi,Jhi-i,W[k].lo))) {
+           else if (X->hi >= (tmp = translate(0,Rhi->N,Rhi->J-i,W[k].lo))) {
                break;}
 	 }
      }
@@ -1221,6 +1347,139 @@ int narrow_cos(INTERVAL *x, INTERVAL *z)     /* cos(x)=z */
 int narrow_tan(INTERVAL *x, INTERVAL *z)     /* tan(x)=z */
 {  return(intersect_tanII(*x, z) && intersect_inv_tanII(*z, x)); }
 
+
+   /*
+   ****************************************************************
+   Trigonometric narrowings with cached range reductions.
+
+   The caller keeps one TRIG_REDUCTION per endpoint of x between
+   calls. An endpoint is only reduced again when it differs from the
+   value it was reduced for, so a propagator that is rescheduled
+   because of its other argument, or because only one bound of x
+   moved, skips the extended precision reduction of the unchanged
+   endpoints.
+   ****************************************************************
+   */
+void trig_reduction_init(TRIG_REDUCTION *r)
+{
+  r->cached = 0;
+}
+
+static void reduce_trig_cached(int hilo, double x, TRIG_REDUCTION *r)
+{
+  if (r->cached && (r->x == x))
+    return;
+  r->ok = reduce_trig(hilo, x, &r->N, &r->J, &r->Z);
+  r->x = x;
+  r->cached = 1;
+}
+
+int intersect_sin_cachedII(INTERVAL x, INTERVAL *z,
+                           TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{
+  reduce_trig_cached(0,x.lo,lo);
+  reduce_trig_cached(1,x.hi,hi);
+  return(intersectionII(periodic_reducedII(lo,hi,range_sin,eval_sin,eval_sin_pair,makeDDI(-1,1),4),z));
+}
+
+int intersect_cos_cachedII(INTERVAL x, INTERVAL *z,
+                           TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{
+  reduce_trig_cached(0,x.lo,lo);
+  reduce_trig_cached(1,x.hi,hi);
+  return(intersectionII(periodic_reducedII(lo,hi,range_cos,eval_cos,eval_cos_pair,makeDDI(-1,1),4),z));
+}
+
+int intersect_inv_sin_cachedII(INTERVAL z, INTERVAL *x,
+                               TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{
+  reduce_trig_cached(0,x->lo,lo);
+  reduce_trig_cached(1,x->hi,hi);
+  return(intersect_inv_periodic_reducedII(z,x,lo,hi,eval_asin,translate_trig,makeDDI(-1,1),4));
+}
+
+int intersect_inv_cos_cachedII(INTERVAL z, INTERVAL *x,
+                               TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{
+  reduce_trig_cached(0,x->lo,lo);
+  reduce_trig_cached(1,x->hi,hi);
+  return(intersect_inv_periodic_reducedII(z,x,lo,hi,eval_acos,translate_trig,makeDDI(-1,1),4));
+}
+
+int narrow_sin_cached(INTERVAL *x, INTERVAL *z,
+                      TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{  return(intersect_sin_cachedII(*x, z, lo, hi) &&
+          intersect_inv_sin_cachedII(*z, x, lo, hi)); }
+
+int narrow_cos_cached(INTERVAL *x, INTERVAL *z,
+                      TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{  return(intersect_cos_cachedII(*x, z, lo, hi) &&
+          intersect_inv_cos_cachedII(*z, x, lo, hi)); }
+
+int narrow_tan_cached(INTERVAL *x, INTERVAL *z,
+                      TRIG_REDUCTION *lo, TRIG_REDUCTION *hi)
+{
+  INTERVAL one;
+
+  reduce_trig_cached(0,x->lo,lo);
+  reduce_trig_cached(1,x->hi,hi);
+
+  one = makeDDI(-1,1);
+  if (!intersectionII(divIII(periodic_reducedII(lo,hi,range_sin,eval_sin,eval_sin_pair,one,4),
+                             periodic_reducedII(lo,hi,range_cos,eval_cos,eval_cos_pair,one,4)),z))
+    return(FAIL);
+
+  return(intersect_inv_periodic_reducedII(*z,x,lo,hi,eval_atan,translate_trig,PN_INF.i,4));
+}
+
+
+   /*
+   ****************************************************************
+   int narrow_sincos(INTERVAL *x, INTERVAL *s, INTERVAL *c)
+
+   Narrows sin(x)=s and cos(x)=c together. Both endpoints of x are
+   reduced mod pi/2 only once and the reduction is shared by the
+   four semi-narrowings. In between, s and c are narrowed with
+   each other through s^2 + c^2 = 1.
+   ****************************************************************
+   */
+int narrow_sincos(INTERVAL *x, INTERVAL *s, INTERVAL *c)
+{
+  TRIG_REDUCTION Rlo,Rhi;
+
+  trig_reduction_init(&Rlo);
+  trig_reduction_init(&Rhi);
+  return(narrow_sincos_cached(x,s,c,&Rlo,&Rhi));
+}
+
+int narrow_sincos_cached(INTERVAL *x, INTERVAL *s, INTERVAL *c,
+                         TRIG_REDUCTION *Rlo, TRIG_REDUCTION *Rhi)
+{
+  INTERVAL one,t;
+
+  reduce_trig_cached(0,x->lo,Rlo);
+  reduce_trig_cached(1,x->hi,Rhi);
+
+  one = makeDDI(-1,1);
+  if (!intersectionII(periodic_reducedII(Rlo,Rhi,range_sin,eval_sin,eval_sin_pair,one,4),s))
+    return(FAIL);
+  if (!intersectionII(periodic_reducedII(Rlo,Rhi,range_cos,eval_cos,eval_cos_pair,one,4),c))
+    return(FAIL);
+
+  /* |s| = sqrt(1-c^2) and |c| = sqrt(1-s^2) */
+  t = subDII(1.0,squareII(*c));
+  if (t.lo < 0.0) t.lo = 0.0;
+  if ((t.hi < 0.0) || !intersect_inv_abs(sqrtII(t),s))
+    return(FAIL);
+  t = subDII(1.0,squareII(*s));
+  if (t.lo < 0.0) t.lo = 0.0;
+  if ((t.hi < 0.0) || !intersect_inv_abs(sqrtII(t),c))
+    return(FAIL);
+
+  return(intersect_inv_periodic_reducedII(*s,x,Rlo,Rhi,eval_asin,translate_trig,one,4) &&
+         intersect_inv_periodic_reducedII(*c,x,Rlo,Rhi,eval_acos,translate_trig,one,4));
+}
+
 /* **************************************************************** */
 
 
@@ -9,12 +9,179 @@
 #include "smath.h"
 #include <stdio.h>
 
+    /*
+    ****************************************************************
+    Soundly rounded integer powers and roots of non-negative doubles
+
+    pow_int_lo(a,n) <= a^n <= pow_int_hi(a,n)      for a >= 0, n >= 0
+
+    The power is computed by repeated squaring, all the partial
+    products are non-negative so it is enough to round every
+    multiplication in the same direction.
+
+    root_int_lo(z,n) is the largest double r with r^n <= z and
+    root_int_hi(z,n) is the smallest double r with z <= r^n,
+    i.e. they are the correctly rounded n-th roots of z >= 0
+    (up to the rounding of the power used for the check).
+    ****************************************************************
+    */
+
+double pow_int_lo(double a, int n) {
+  double r = 1.0;
+
+  if (n == 2) return(mul_lo(a,a));
+  if (n == 3) return(mul_lo(mul_lo(a,a),a));
+
+  while (n > 0) {
+    if (n & 1) r = mul_lo(r,a);
+    n >>= 1;
+    if (n) a = mul_lo(a,a);
+  }
+  return(r);
+}
+
+double pow_int_hi(double a, int n) {
+  double r = 1.0;
+
+  if (n == 2) return(mul_hi(a,a));
+  if (n == 3) return(mul_hi(mul_hi(a,a),a));
+
+  while (n > 0) {
+    if (n & 1) r = mul_hi(r,a);
+    n >>= 1;
+    if (n) a = mul_hi(a,a);
+  }
+  return(r);
+}
+
+static double root_int_guess(double z, int n) {
+  if (n == 2) return(sqrt(z));
+  if (n == 3) return(cbrt(z));
+  return(pow(z,1.0/n));
+}
+
+double root_int_lo(double z, int n) {
+  double r,s;
+
+  if (z <= 0.0) return(0.0);
+  if (n == 1) return(z);
+  if (isinf(z)) return(z);
+
+  r = root_int_guess(z,n);
+  while ((r > 0.0) && (pow_int_hi(r,n) > z))
+    r = prev_fp(r);
+  while (pow_int_hi(s = next_fp(r),n) <= z)
+    r = s;
+  return(r);
+}
+
+double root_int_hi(double z, int n) {
+  double r,s;
+
+  if (z <= 0.0) return(0.0);
+  if (n == 1) return(z);
+  if (isinf(z)) return(z);
+
+  r = root_int_guess(z,n);
+  while (pow_int_lo(r,n) < z)
+    r = next_fp(r);
+  while (((s = prev_fp(r)) > 0.0) && (pow_int_lo(s,n) >= z))
+    r = s;
+  return(r);
+}
+
+
+    /*
+    ****************************************************************
+    Interval extension of x^n for an integer n >= 0
+    ****************************************************************
+    */
+
+INTERVAL pow_intII(INTERVAL x, int n) {
+  INTERVAL z;
+
+  if (n == 0) return(cnstDI(1.0));
+  if (n == 1) return(x);
+
+  if (x.lo >= 0.0) {                    /* x is positive */
+    z.lo = pow_int_lo(x.lo,n);
+    z.hi = pow_int_hi(x.hi,n);
+  }
+  else if (x.hi <= 0.0) {               /* x is negative */
+    if (n % 2 == 0) {
+      z.lo = pow_int_lo(-x.hi,n);
+      z.hi = pow_int_hi(-x.lo,n);
+    }
+    else {
+      z.lo = -pow_int_hi(-x.lo,n);
+      z.hi = -pow_int_lo(-x.hi,n);
+    }
+  }
+  else {                                /* x is split */
+    if (n % 2 == 0) {
+      z.lo = 0.0;
+      z.hi = pow_int_hi((x.hi > -x.lo) ? x.hi : -x.lo, n);
+    }
+    else {
+      z.lo = -pow_int_hi(-x.lo,n);
+      z.hi = pow_int_hi(x.hi,n);
+    }
+  }
+  return(z);
+}
+
+
+    /*
+    ****************************************************************
+    int narrow_pow_int(INTERVAL *x, int n, INTERVAL *z)
+
+    Narrows x^n = z for an integer n >= 0. The forward pass uses
+    pow_intII, the backward pass the correctly rounded n-th roots
+    of the bounds of z. For n even the inverse image is the union
+    [-b,-a] u [a,b], and the hole (-a,a) is removed from x
+    whenever it sits at one of its ends.
+    ****************************************************************
+    */
+
+int narrow_pow_int(INTERVAL *x, int n, INTERVAL *z) {
+  INTERVAL y;
+
+  if (n == 0) {
+    if (z->lo < 1.0) z->lo = 1.0;
+    if (z->hi > 1.0) z->hi = 1.0;
+    return(z->lo <= z->hi);
+  }
+  if (n == 1) return(narrow_eq(x,z));
+
+  *z = intersectIII(*z,pow_intII(*x,n));
+  if (z->lo > z->hi) return(FAIL);
+
+  if (n % 2 == 0) {
+    y.lo = root_int_lo(z->lo,n);
+    y.hi = root_int_hi(z->hi,n);
+    if (!intersect_inv_abs(y,x)) return(FAIL);
+  }
+  else {
+    y.lo = (z->lo >= 0.0) ? root_int_lo(z->lo,n) : -root_int_hi(-z->lo,n);
+    y.hi = (z->hi >= 0.0) ? root_int_hi(z->hi,n) : -root_int_lo(-z->hi,n);
+    *x = intersectIII(*x,y);
+  }
+
+  return((z->lo <= z->hi) && (x->lo <= x->hi));
+}
+
+
     /*
     ****************************************************************
     Narrowing procedures for odd and even integer powers
     ****************************************************************
     */
 
+static int is_int_exponent(INTERVAL *y) {
+  return((y->lo == y->hi) && (y->lo >= 0.0) && (y->lo <= 1024.0) &&
+         (floor(y->lo) == y->lo));
+}
+
 int narrow_pow_odd(INTERVAL *x, INTERVAL *y, INTERVAL *z) {
   /* here we use x^y = z => abs(x)^y = abs(z),m for y odd */
   /* this I need to redo, it is pretty ugly! */
@@ -35,6 +202,9 @@ int narrow_pow_odd(INTERVAL *x, INTERVAL *y, INTERVAL *z) {
 
  INTERVAL  t1; //,t2;
 
+    if (is_int_exponent(y))
+      return(narrow_pow_int(x,(int)y->lo,z));
+
 /*
     t1 = mulIII(sgnII(cnstDI(x->lo)),expII(mulIII(*y,logII(absII(cnstDI(x->lo))))));
     t2 = mulIII(sgnII(cnstDI(x->hi)),expII(mulIII(*y,logII(absII(cnstDI(x->hi))))));
@@ -91,6 +261,9 @@ int narrow_pow_even(INTERVAL *x, INTERVAL *y, INTERVAL *z) {
   int result;
   int debug = 0;
 
+  if (is_int_exponent(y))
+    return(narrow_pow_int(x,(int)y->lo,z));
+
   if (debug) {
     printf("Entering pow_even\n");
     print_interval("x =",*x);
@@ -134,6 +134,26 @@ typedef struct ext_prec {
 } EXT_PREC;
 
 
+    /*
+    ****************************************************************
+    Range reduction of one endpoint of a periodic function argument:
+        x = Z + a_J + N*period
+    ok is 0 if the reduction could not be computed. A reduction
+    can be kept between calls as a cache for the endpoint x, it
+    must be cleared with trig_reduction_init before its first use.
+    ****************************************************************
+    */
+
+typedef struct trig_reduction {
+  double x;
+  int    cached;
+  int    ok;
+  double N;
+  int    J;
+  double Z;
+} TRIG_REDUCTION;
+
+
 #define FAIL 0
 #define TRUE 1
 
@@ -200,6 +220,18 @@ int narrow_eqfn(INTERVAL *x,INTERVAL *y, INTERVAL *z);
 int narrow_sin(INTERVAL *x,INTERVAL *y);
 int narrow_cos(INTERVAL *x,INTERVAL *y);
 int narrow_tan(INTERVAL *x,INTERVAL *y);
+int narrow_sincos(INTERVAL *x,INTERVAL *s, INTERVAL *c);
+
+void trig_reduction_init(TRIG_REDUCTION *r);
+int narrow_sin_cached(INTERVAL *x,INTERVAL *y,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int narrow_cos_cached(INTERVAL *x,INTERVAL *y,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int narrow_tan_cached(INTERVAL *x,INTERVAL *y,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int narrow_sincos_cached(INTERVAL *x,INTERVAL *s, INTERVAL *c,
+                         TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int intersect_sin_cachedII(INTERVAL x,INTERVAL *z,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int intersect_cos_cachedII(INTERVAL x,INTERVAL *z,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int intersect_inv_sin_cachedII(INTERVAL z,INTERVAL *x,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
+int intersect_inv_cos_cachedII(INTERVAL z,INTERVAL *x,TRIG_REDUCTION *lo,TRIG_REDUCTION *hi);
 
 int narrow_asin(INTERVAL *x,INTERVAL *y);
 int narrow_acos(INTERVAL *x,INTERVAL *y);
@@ -219,6 +251,7 @@ int narrow_subset(INTERVAL *x,INTERVAL *y);
 /* power narrowing procedures */
 int narrow_pow_odd(INTERVAL *x, INTERVAL *y, INTERVAL *z);
 int narrow_pow_even(INTERVAL *x, INTERVAL *y, INTERVAL *z);
+int narrow_pow_int(INTERVAL *x, int n, INTERVAL *z);
 
 
     /*
@@ -234,6 +267,9 @@ int narrow_pow_even(INTERVAL *x, INTERVAL *y, INTERVAL *z);
 int intersect_mulIII(INTERVAL a, INTERVAL b, INTERVAL *x);
 int intersect_divIII(INTERVAL a, INTERVAL b, INTERVAL *x);
 
+int intersect_abs(INTERVAL x, INTERVAL *z);
+int intersect_inv_abs(INTERVAL z, INTERVAL *x);
+
 int intersect_sin2piII(INTERVAL z, INTERVAL *x);
 int intersect_cos2piII(INTERVAL z, INTERVAL *x);
 int intersect_tan2piII(INTERVAL z, INTERVAL *x);
@@ -283,9 +319,12 @@ INTERVAL maxIII(INTERVAL a,INTERVAL b);
 INTERVAL minIII(INTERVAL a,INTERVAL b);
 
 INTERVAL two_to_nDI(int n);
+INTERVAL pow_intII(INTERVAL X, int n);
 
 INTERVAL expII(INTERVAL X);
 INTERVAL logII(INTERVAL X);
+void expII_batch(const INTERVAL *X, INTERVAL *Y, int n);
+void logII_batch(const INTERVAL *X, INTERVAL *Y, int n);
 
 
 INTERVAL sin2piII(INTERVAL X);
@@ -297,6 +336,8 @@ INTERVAL atan2piII(INTERVAL X);
 
 INTERVAL sinII(INTERVAL X);
 INTERVAL cosII(INTERVAL X);
+void sinII_batch(const INTERVAL *X, INTERVAL *Y, int n);
+void cosII_batch(const INTERVAL *X, INTERVAL *Y, int n);
 INTERVAL tanII(INTERVAL X);
 INTERVAL asinII(INTERVAL X);
 INTERVAL acosII(INTERVAL X);
@@ -332,6 +373,7 @@ INTERVAL atan2piDI(double x);
 
 INTERVAL sin0DI(double x);
 INTERVAL cos0DI(double x);
+void sincos0_pairDI(const double x[2], const int is_cos[2], INTERVAL y[2]);
 INTERVAL tan0DI(double x);
 INTERVAL asinDI(double x);
 INTERVAL acosDI(double x);
@@ -370,6 +412,12 @@ double log_lo(double x);
 double sqrt_hi(double x);
 double sqrt_lo(double x);
 
+double pow_int_hi(double x, int n);
+double pow_int_lo(double x, int n);
+
+double root_int_hi(double x, int n);
+double root_int_lo(double x, int n);
+
 
 
 double sin2pi0_lo(double x);
@@ -28,6 +28,9 @@
 2003-05-06  added comments about rounding modes and optimization   dkw
 
 2003-12-12  removed some includes duplicated by smath               dkw
+
+2026-10-19  rounding through <fenv.h>, every sound operation restores
+            the caller's rounding mode (reentrant, per thread)
  
 */
 
@@ -54,20 +57,25 @@
 #include "smath.h" 
 #include <stdio.h>
 
-/* Setting the rounding mode now relies on mpfr */
+/* Setting the rounding mode relies on <fenv.h>. The floating point
+   environment belongs to the calling thread, and roundup/rounddn save
+   the mode they find so that roundrs can put it back. No state is
+   shared between threads and the caller never sees a changed mode. */
+
+#include <fenv.h>
 
-#include <mpfr.h>
+// FE_TONEAREST: round to nearest
+// FE_TOWARDZERO: round towards zero
+// FE_UPWARD: round towards plus infinity
+// FE_DOWNWARD: round towards minus infinity
 
-// GMP_RNDN: round to nearest
-// GMP_RNDZ: round towards zero
-// GMP_RNDU: round towards plus infinity
-// GMP_RNDD: round towards minus infinity
+#define  roundup   int rnd_mode_ = fegetround(); fesetround(FE_UPWARD);
 
-#define  roundup   mpfr_set_default_rounding_mode(GMP_RNDU);
+#define roundnr    int rnd_mode_ = fegetround(); fesetround(FE_TONEAREST);
 
-#define roundnr    mpfr_set_default_rounding_mode(GMP_RNDN);
+#define  rounddn   int rnd_mode_ = fegetround(); fesetround(FE_DOWNWARD);
 
-#define  rounddn   mpfr_set_default_rounding_mode(GMP_RNDD);
+#define  roundrs   fesetround(rnd_mode_);
 
 
 #if BYTE_ORDER == LITTLE_ENDIAN
@@ -170,68 +178,98 @@ double prev_fp(double x)
 
 double add_hi(double x,double y)
 {
+  volatile double z;
   roundup;
-  return(x+y);
+  z = x+y;
+  roundrs;
+  return(z);
 }
 
 double add_lo(double x,double y)
 {
+  volatile double z;
   rounddn;
-  return(x+y);
+  z = x+y;
+  roundrs;
+  return(z);
 }
 
 double sub_hi(double x,double y)
 {
+  volatile double z;
   roundup;
-  return(x-y);
+  z = x-y;
+  roundrs;
+  return(z);
 }
 
 double sub_lo(double x,double y)
 {
+  volatile double z;
   rounddn;
-  return(x-y);
+  z = x-y;
+  roundrs;
+  return(z);
 }
 
 double mul_hi(double x,double y)
 {
+  volatile double z;
   roundup;
-  return(x*y);
+  z = x*y;
+  roundrs;
+  return(z);
 }
 
 double mul_lo(double x,double y)
 {
+  volatile double z;
   rounddn;
-  return(x*y);
+  z = x*y;
+  roundrs;
+  return(z);
 }
 
 double div_hi(double x,double y)
 {
-  double z;
+  volatile double z;
   roundup;
   z = x/y;
+  roundrs;
   return(z);
 }
 
 double div_lo(double x, double y)
 {
- double z;
+  volatile double z;
   rounddn;
   z = x/y;
+  roundrs;
   return(z);
 }
 
 double sqrt_hi(double x)
 {
+  volatile double z;
   if (x==0) return(0.0);
-  roundup;
-  return(sqrt(x));
+  {
+    roundup;
+    z = sqrt(x);
+    roundrs;
+  }
+  return(z);
 }
 
 double sqrt_lo(double x)
 {
+  volatile double z;
   if (x==0) return(0.0);
-  rounddn;
-  return(sqrt(x));
+  {
+    rounddn;
+    z = sqrt(x);
+    roundrs;
+  }
+  return(z);
 }
 /* above here, we assume rounding is fpset */
 
@@ -296,11 +334,13 @@ double x,y;
 double sqrt_hi(x)
 double x;
 {
-  double a;
+  volatile double a;
   if (x==0) return(0.0);
-  roundup;
-  a = sqrt(x);
-  rounddn;
+  {
+    roundup;
+    a = sqrt(x);
+    roundrs;
+  }
    return(a);
 }
 
@@ -0,0 +1,63 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+#include <cpfloat/search/box.hh>
+
+/// Returns the number of solutions of the engine \a E with options \a o
+template <template<class> class E, class O>
+unsigned int pave(const O& o, bool& stopped) {
+  HC4Bronstein* s = new HC4Bronstein();
+  E<HC4Bronstein> e(s,o);
+  delete s;
+  unsigned int n = 0;
+  while (HC4Bronstein* t = e.next()) {
+    n++;
+    delete t;
+  }
+  stopped = e.stopped();
+  return n;
+}
+
+int main(int, char**) {
+  Check check;
+  BoxOptions o;
+  minimum<Quadratic,BestFirst>(check,"Best-first",-1.0,o);
+  minimum<Circle,BestFirst>(check,"Best-first",0.0,o);
+  o.memory = 4096;
+  o.spill = true;
+  minimum<Quadratic,BestFirst>(check,"Best-first, spilled",-1.0,o);
+  minimum<Circle,BestFirst>(check,"Best-first, spilled",0.0,o);
+
+  bool stopped;
+  unsigned int d = pave<DFS>(Search::Options::def,stopped);
+  unsigned int b = pave<BreadthFirst>(BoxOptions(),stopped);
+  std::ostringstream w;
+  w << "Paving: " << d << " boxes depth-first, " << b << " breadth-first";
+  // the same tree, explored in another order
+  check((d > 0) && (d == b) && !stopped,w.str());
+  o.memory = 1;
+  o.spill = false;
+  (void) pave<BreadthFirst>(o,stopped);
+  check(stopped,"Paving: stopped at the memory bound");
+  return check.status();
+}
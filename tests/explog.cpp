@@ -0,0 +1,80 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+#include <cmath>
+
+/// Checks that \f$ e^x = y \f$ on the domains \a d narrows \a y below \a u
+void check_exp(Check& check, const BoundType d[4], BoundType u) {
+  Vars s(2,d);
+  exp(s,s[0],s[1]);
+  std::ostringstream w;
+  w << "exp(x) = y, x in [" << d[0] << "," << d[1] << "], y in ["
+    << d[2] << "," << d[3] << "]: ";
+  bool ok = (s.status() != SS_FAILED);
+  if (ok) {
+    w << s[0] << ", " << s[1];
+    ok = (s[1].glb() >= 0.0) && (s[1].glb() <= std::exp(d[0])) &&
+      (s[1].lub() >= std::exp(d[1])) && (s[1].lub() <= u);
+  } else {
+    w << "failed";
+  }
+  check(ok,w.str());
+}
+
+/// Checks that \f$ \log x = y \f$ on the domains \a d narrows \a y below \a u
+void check_log(Check& check, const BoundType d[4], BoundType u) {
+  Vars s(2,d);
+  log(s,s[0],s[1]);
+  std::ostringstream w;
+  w << "log(x) = y, x in [" << d[0] << "," << d[1] << "], y in ["
+    << d[2] << "," << d[3] << "]: ";
+  bool ok = (s.status() != SS_FAILED);
+  if (ok) {
+    w << s[0] << ", " << s[1];
+    ok = (s[1].glb() == d[2]) && (s[1].lub() <= u) &&
+      (s[1].lub() >= std::log(d[1]));
+  } else {
+    w << "failed";
+  }
+  check(ok,w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  // e^x is subnormal, the logarithm of y.lo used to read outside its table
+  const BoundType sn[4] = {-720.0, -700.0, -1.0, 1.0};
+  check_exp(check,sn,1e-300);
+  // e^x underflows to zero or to the smallest subnormal number
+  const BoundType uf[4] = {-1000.0, -750.0, -1.0, 1.0};
+  check_exp(check,uf,1e-320);
+
+  // log(DBL_MIN) is about -708.396, bounding the logarithm of subnormals
+  const BoundType lz[4] = {0.0, 1e-310, -1000.0, 0.0};
+  check_log(check,lz,-708.39);
+  const BoundType ls[4] = {1e-320, 1e-310, -1000.0, 0.0};
+  check_log(check,ls,-708.39);
+
+  return check.status();
+}
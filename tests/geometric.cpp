@@ -0,0 +1,106 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+#include <cmath>
+
+/**
+ * \brief The model of tests/chemistry-k3b.cpp
+ *
+ * The domains span eight orders of magnitude. The default constructor
+ * branches with firstfail() as tests/chemistry-k3b.cpp does, the other
+ * splits the smallest domain at the value selection \a vals.
+ */
+class Chemistry : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+  /// Posts the equations
+  void post(void) {
+    VarExpression x1(a_[0]), x2(a_[1]), x3(a_[2]), x4(a_[3]), x5(a_[4]);
+
+    BoundType R = 10;
+    BoundType R5 = 0.193;
+    BoundType R6 = 0.002597/std::sqrt(40.0);
+    BoundType R7 = 0.003448/std::sqrt(40.0);
+    BoundType R8 = 0.00001799/40;
+    BoundType R9 = 0.0002155/std::sqrt(40.0);
+    BoundType R10 = 0.00003846/40;
+
+    k3b(*this, 3*x5 == x1*(x2 + 1) );
+    k3b(*this, x3*(x2*(2*x3+R7) + 2*R5*x3 + R6) ==  8*x5 );
+    k3b(*this, x4*(R9*x2 + 2*x4) == 4*R*x5 );
+    k3b(*this, x2*(2*x1 + x3*(x3+R7) + R8 + 2*R10*x2 + R9*x4) + x1 == R*x5 );
+    k3b(*this, x2*(x1 + R10*x2 + x3*(x3+R7) + R8 + R9*x4) +x1 + x3*(R5*x3 + R6) + (x4^2) == 1 );
+  }
+public:
+  Chemistry(void)
+    : a_(*this, 5, 0, 100000000) {
+    post();
+    firstfail(*this,a_);
+  }
+  Chemistry(CPFloatValBranch vals)
+    : a_(*this, 5, 0, 100000000) {
+    post();
+    branch(*this,a_,CPFLOAT_VAR_SIZE_MIN,vals);
+  }
+  Box box(void) const {
+    return ::box(a_);
+  }
+  Chemistry(bool share, Chemistry& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Chemistry(share,*this);
+  }
+};
+
+/// Checks that splitting at \a vals finds the solutions \a d
+void check_split(Check& check, const char* name, CPFloatValBranch vals,
+                 const std::vector<Box>& d) {
+  unsigned long int n;
+  std::vector<Box> s = solutions(new Chemistry(vals),n);
+  std::ostringstream w;
+  w << "Chemistry, " << name << ": " << s.size() << " solutions, "
+    << n << " nodes";
+  check(!s.empty() && covered(s,d,1e-6) && covered(d,s,1e-6),w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  unsigned long int n;
+  std::vector<Box> d = solutions(new Chemistry(),n);
+  std::ostringstream w;
+  w << "Chemistry, firstfail: " << d.size() << " solutions, " << n << " nodes";
+  check(!d.empty(),w.str());
+
+  check_split(check,"geometric midpoint, upper half first",
+              CPFLOAT_VAL_GEOM_MAX,d);
+  check_split(check,"geometric midpoint, lower half first",
+              CPFLOAT_VAL_GEOM_MIN,d);
+  check_split(check,"middle exponent band, upper half first",
+              CPFLOAT_VAL_EXP_MAX,d);
+
+  return check.status();
+}
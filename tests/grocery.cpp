@@ -0,0 +1,123 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/// How the sum and the product of the prices are posted
+enum GroceryModel {
+  GROCERY_DECOMPOSED, ///< Chains of addition, times and equality
+  GROCERY_LINEAR,     ///< linear() for the sum
+  GROCERY_POLYNOMIAL  ///< linear() for the sum, polynomial() for the product
+};
+
+/**
+ * \brief The grocery puzzle of tests/floatgrocery.cpp, two prices known
+ *
+ * With \f$ w = 1.20 \f$ and \f$ x = 1.25 \f$ the other prices are 1.50
+ * and 3.16, in either order.
+ */
+class Grocery : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+public:
+  Grocery(GroceryModel m)
+    : a_(*this, 4, 0.1, 7.11) {
+    CPFloatVar w = a_[0], x = a_[1], y = a_[2], z = a_[3];
+    equality(*this,w,1.20);
+    equality(*this,x,1.25);
+
+    if (m == GROCERY_DECOMPOSED) {
+      CPFloatVar a1 = CPFloatVar(*this, 0.1, 7.11);
+      CPFloatVar a2 = CPFloatVar(*this, 0.1, 7.11);
+      CPFloatVar a3 = CPFloatVar(*this, 0.1, 7.11);
+      addition(*this,w,x,a1);
+      addition(*this,a1,y,a2);
+      addition(*this,a2,z,a3);
+      equality(*this,a3,7.11);
+    } else {
+      CPFloatArgs a(4);
+      a[0] = a[1] = a[2] = a[3] = 1.0;
+      linear(*this,a,a_,CPFLOAT_RT_EQ,7.11);
+    }
+
+    if (m == GROCERY_POLYNOMIAL) {
+      CPFloatArgs c(1);
+      CPFloatIntArgs e(4);
+      c[0] = 1.0;
+      e[0] = e[1] = e[2] = e[3] = 1;
+      polynomial(*this,c,e,a_,CPFLOAT_RT_EQ,7.11);
+    } else {
+      CPFloatVar t1 = CPFloatVar(*this, 0.1, 7.11);
+      CPFloatVar t2 = CPFloatVar(*this, 0.1, 7.11);
+      CPFloatVar t3 = CPFloatVar(*this, 0.1, 7.11);
+      times(*this,w,x,t1);
+      times(*this,t1,y,t2);
+      times(*this,t2,z,t3);
+      equality(*this,t3,7.11);
+    }
+
+    branch(*this,y);
+    branch(*this,z);
+  }
+  Box box(void) const {
+    return ::box(a_);
+  }
+  Grocery(bool share, Grocery& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Grocery(share,*this);
+  }
+};
+
+/// Checks that the model \a m has the solutions \a d of the decomposed model
+void check_grocery(Check& check, const char* name, GroceryModel m,
+                   const std::vector<Box>& d) {
+  unsigned long int n;
+  std::vector<Box> s = solutions(new Grocery(m),n);
+  std::ostringstream w;
+  w << "Grocery, " << name << ": " << s.size() << " solutions, "
+    << n << " nodes";
+  check(!s.empty() && covered(s,d,1e-6) && covered(d,s,1e-6),w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  unsigned long int n;
+  std::vector<Box> d = solutions(new Grocery(GROCERY_DECOMPOSED),n);
+  // y and z are 1.50 and 3.16 in either order
+  std::vector<Box> r(2,Box(4));
+  r[0][0] = r[1][0] = std::make_pair(1.20,1.20);
+  r[0][1] = r[1][1] = std::make_pair(1.25,1.25);
+  r[0][2] = r[1][3] = std::make_pair(1.50,1.50);
+  r[0][3] = r[1][2] = std::make_pair(3.16,3.16);
+  std::ostringstream w;
+  w << "Grocery, decomposed: " << d.size() << " solutions, " << n << " nodes";
+  check(!d.empty() && covered(d,r,1e-6) && covered(r,d,1e-6),w.str());
+
+  check_grocery(check,"linear",GROCERY_LINEAR,d);
+  check_grocery(check,"polynomial",GROCERY_POLYNOMIAL,d);
+
+  return check.status();
+}
@@ -0,0 +1,82 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+#include <iomanip>
+
+/// Rastrigin function in three dimensions, minimum 0 at the origin
+class Rastrigin : public MinimizeSpace {
+protected:
+  CPFloatVarArray a_;
+public:
+  Rastrigin(void)
+    : MinimizeSpace(1e-4,1e-4), a_(*this, 3, -5.12, 5.12) {
+    VarExpression x(a_[0]), y(a_[1]), z(a_[2]);
+    const BoundType twopi = 6.283185307179586;
+
+    objective(((x^2) - (10.0 * (twopi*x).cos())) +
+              ((y^2) - (10.0 * (twopi*y).cos())) +
+              ((z^2) - (10.0 * (twopi*z).cos())) + 30.0);
+
+    branch(*this,a_,CPFLOAT_VAR_SIZE_MAX,CPFLOAT_VAL_SPLIT_MIN);
+  }
+  virtual CPFloatVarArgs variables(void) const {
+    return a_;
+  }
+  Rastrigin(bool share, Rastrigin& sp)
+    : MinimizeSpace(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Rastrigin(share,*this);
+  }
+};
+
+/// Minimizes with \a threads workers, checks that the enclosure is certified
+void run(Check& check, unsigned int threads) {
+  Rastrigin* m = new Rastrigin();
+  BoundType a = m->absolute(), r = m->relative();
+  Search::Options o;
+  o.threads = threads;
+  Support::Timer t;
+  t.start();
+  Minimize<Rastrigin> e(m,o);
+  delete m;
+  while (Rastrigin* s = e.next())
+    delete s;
+  double ms = t.stop();
+  Search::Statistics st = e.statistics();
+  std::ostringstream w;
+  w << std::setw(2) << threads << " threads: "
+    << std::setw(10) << std::fixed << std::setprecision(1) << ms
+    << " ms, " << st.node << " nodes, " << st.fail << " failures,"
+    << " minimum in [" << std::scientific << e.lower() << ","
+    << e.upper() << "]";
+  check(certified(e.lower(),e.upper(),0.0,a,r),w.str());
+}
+
+int main(int, char**) {
+  Check check;
+  for (unsigned int t=1; t<=8; t*=2)
+    run(check,t);
+  return check.status();
+}
@@ -0,0 +1,76 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/**
+ * \brief Checks that \f$ \sum_{k} c_k x^{e_k} \; r \; 0 \f$ narrows \a d to \a r
+ *
+ * \a r is NULL when propagation must fail.
+ */
+void check_polynomial(Check& check, const char* name, int m,
+                      const BoundType* c, const int* e, CPFloatRelType rel,
+                      const BoundType d[2], const BoundType* r) {
+  Vars s(1,d);
+  CPFloatArgs ca(m);
+  CPFloatIntArgs ea(m);
+  for (int k=0; k<m; k++) {
+    ca[k] = c[k];
+    ea[k] = e[k];
+  }
+  CPFloatVarArgs x(1);
+  x[0] = s[0];
+  polynomial(s,ca,ea,x,rel,0.0);
+  std::ostringstream w;
+  w << name << ", x in [" << d[0] << "," << d[1] << "]: ";
+  bool ok;
+  if (r == NULL) {
+    ok = (s.status() == SS_FAILED);
+    w << "failed";
+  } else {
+    ok = s.propagates(r);
+    w << s[0];
+  }
+  check(ok,w.str());
+}
+
+int main(int, char**) {
+  Check check;
+  const BoundType d[2] = {-3.0, -1.0};
+
+  // constant polynomials, x does not occur
+  const BoundType c5[2] = {5.0, -3.0};
+  const int e0[2] = {0, 0};
+  check_polynomial(check,"5 - 3 = 0",2,c5,e0,CPFLOAT_RT_EQ,d,NULL);
+  check_polynomial(check,"5 - 3 <= 0",2,c5,e0,CPFLOAT_RT_LQ,d,NULL);
+  check_polynomial(check,"5 - 3 >= 0",2,c5,e0,CPFLOAT_RT_GQ,d,d);
+  const BoundType c3[2] = {5.0, -5.0};
+  check_polynomial(check,"5 - 5 = 0",2,c3,e0,CPFLOAT_RT_EQ,d,d);
+
+  // a constant monomial next to a power of x
+  const BoundType cq[2] = {1.0, -2.0};
+  const int eq[2] = {2, 0};
+  const BoundType sq[2] = {-std::sqrt(2.0), -std::sqrt(2.0)};
+  check_polynomial(check,"x^2 - 2 = 0",2,cq,eq,CPFLOAT_RT_EQ,d,sq);
+
+  return check.status();
+}
@@ -0,0 +1,85 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/// Checks that \f$ x^e = y \f$ narrows the domains \a d to \a r
+void check_power(Check& check, int e, const BoundType d[4], const BoundType r[4]) {
+  Vars s(2,d);
+  power(s,s[0],e,s[1]);
+  std::ostringstream w;
+  w << "x^" << e << " = y, x in [" << d[0] << "," << d[1] << "], y in ["
+    << d[2] << "," << d[3] << "]: " << s[0] << ", " << s[1];
+  check(s.propagates(r),w.str());
+}
+
+/// Checks that \f$ x / y = z \f$ narrows the domains \a d to \a r
+void check_division(Check& check, const BoundType d[6], const BoundType* r) {
+  Vars s(3,d);
+  division(s,s[0],s[1],s[2]);
+  std::ostringstream w;
+  w << "x / y = z, x in [" << d[0] << "," << d[1] << "], y in ["
+    << d[2] << "," << d[3] << "], z in [" << d[4] << "," << d[5] << "]: ";
+  bool ok;
+  if (r == NULL) {
+    ok = (s.status() == SS_FAILED);
+    w << "failed";
+  } else {
+    ok = s.propagates(r);
+    w << s[0] << ", " << s[1] << ", " << s[2];
+  }
+  check(ok,w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  // x^2 and x^3 use PowSquare and PowCube, x^4 PowEven and x^5 PowOdd
+  const BoundType sq[4]  = {-3.0, -1.0,   4.0, 100.0};
+  const BoundType sqr[4] = {-3.0, -2.0,   4.0,   9.0};
+  check_power(check,2,sq,sqr);
+  const BoundType cu[4]  = {-3.0,  3.0,  -8.0,   1.0};
+  const BoundType cur[4] = {-2.0,  1.0,  -8.0,   1.0};
+  check_power(check,3,cu,cur);
+  const BoundType ev[4]  = {-3.0, -1.0,  16.0, 625.0};
+  const BoundType evr[4] = {-3.0, -2.0,  16.0,  81.0};
+  check_power(check,4,ev,evr);
+  const BoundType ew[4]  = {-3.0,  3.0,  16.0,  16.0};
+  const BoundType ewr[4] = {-2.0,  2.0,  16.0,  16.0};
+  check_power(check,4,ew,ewr);
+  const BoundType od[4]  = {-2.0, -1.0, -64.0,  64.0};
+  const BoundType odr[4] = {-2.0, -1.0, -32.0,  -1.0};
+  check_power(check,5,od,odr);
+
+  // z stays out of the hole (-1,1) of x/y, then y > 0 follows
+  const BoundType st[6]  = {1.0, 2.0, -1.0, 1.0, -0.5, 10.0};
+  const BoundType str[6] = {1.0, 2.0,  0.1, 1.0,  1.0, 10.0};
+  check_division(check,st,str);
+  // nothing to narrow when both x and y straddle zero
+  const BoundType nn[6]  = {-1.0, 1.0, -1.0, 1.0, -10.0, 10.0};
+  check_division(check,nn,nn);
+  // the quotient is undefined
+  const BoundType zr[6]  = {1.0, 2.0, 0.0, 0.0, -10.0, 10.0};
+  check_division(check,zr,NULL);
+
+  return check.status();
+}
@@ -0,0 +1,52 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/// Checks whether [\a l, \a u] is within the precision \a p
+template <class B>
+void within(Check& check, const char* name, const PrecisionSpec<B>& p,
+            B l, B u, bool expected) {
+  std::ostringstream w;
+  w << name << ": [" << l << "," << u << "] "
+    << (expected ? "within" : "not within") << " the precision";
+  check(p.within(l,u) == expected,w.str());
+}
+
+int main(int, char**) {
+  Check check;
+  PrecisionSpec<double> d = PrecisionSpec<double>::ulp(4);
+  within(check,"double",d,1.0,nextafter(1.0,2.0),true);
+  within(check,"double",d,-0.0,0.0,true);
+  within(check,"double",d,-std::numeric_limits<double>::denorm_min(),
+         std::numeric_limits<double>::denorm_min(),true);
+  within(check,"double",d,1.0,2.0,false);
+  // bounds of opposite signs and large magnitudes
+  within(check,"double",d,-3.0,3.0,false);
+  within(check,"double",d,-1e8,1e8,false);
+  within(check,"double",d,-DBL_MAX,DBL_MAX,false);
+  PrecisionSpec<float> f = PrecisionSpec<float>::ulp(4);
+  within(check,"float",f,1.0f,nextafterf(1.0f,2.0f),true);
+  within(check,"float",f,-3.0f,3.0f,false);
+  within(check,"float",f,-FLT_MAX,FLT_MAX,false);
+  return check.status();
+}
@@ -0,0 +1,90 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+#include <cpfloat/search/restart.hh>
+
+/// Bronstein with a randomized branching at every restart
+class RandBronstein : public HC4Bronstein {
+public:
+  RandBronstein(void)
+    : HC4Bronstein(false) {}
+  /// Posts the branching of restart \a r
+  void restart(unsigned int r) {
+    randselection(*this,a_,r);
+  }
+  RandBronstein(bool share, RandBronstein& sp)
+    : HC4Bronstein(share,sp) {}
+  virtual Space* copy(bool share) {
+    return new RandBronstein(share,*this);
+  }
+};
+
+/// Has no solution, every run fails at the root
+class HC4Empty : public RandBronstein {
+public:
+  HC4Empty(void) {
+    VarExpression x(a_[0]);
+    hc4(*this, (x^2) + 1.0 == 0.0 );
+  }
+  HC4Empty(bool share, HC4Empty& sp)
+    : RandBronstein(share,sp) {}
+  virtual Space* copy(bool share) {
+    return new HC4Empty(share,*this);
+  }
+};
+
+/// Returns the first solution of \a Model found with restarts limited by \a c
+template <class Model>
+Box solve(Cutoff& c, unsigned int& restarts) {
+  Model* m = new Model();
+  RBS<Model> e(m,c);
+  delete m;
+  Box b;
+  if (Model* s = e.next()) {
+    b = s->box();
+    delete s;
+  }
+  restarts = e.restarts();
+  return b;
+}
+
+int main(int, char**) {
+  Check check;
+  unsigned int r1, r2;
+  CutoffLuby l1(4), l2(4);
+  Box b1 = solve<RandBronstein>(l1,r1);
+  Box b2 = solve<RandBronstein>(l2,r2);
+  std::ostringstream w;
+  w << "Luby: solution after " << r1 << " restarts";
+  // the same seeds give the same search
+  check(!b1.empty() && (b1 == b2) && (r1 == r2),w.str());
+  CutoffGeometric g(4,1.5);
+  Box b3 = solve<RandBronstein>(g,r1);
+  w.str("");
+  w << "Geometric: solution after " << r1 << " restarts";
+  check(!b3.empty(),w.str());
+  CutoffLuby l3(4);
+  Box b4 = solve<HC4Empty>(l3,r1);
+  check(b4.empty(),"Empty: no solution");
+  return check.status();
+}
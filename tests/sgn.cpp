@@ -0,0 +1,66 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/// Checks that \f$ y = sgn(x) \f$ narrows the domains \a d to \a r
+void check_sgn(Check& check, const BoundType d[4], const BoundType* r) {
+  Vars s(2,d);
+  sgn(s,s[0],s[1]);
+  std::ostringstream w;
+  w << "sgn(x) = y, x in [" << d[0] << "," << d[1] << "], y in ["
+    << d[2] << "," << d[3] << "]: ";
+  bool ok;
+  if (r == NULL) {
+    ok = (s.status() == SS_FAILED);
+    w << "failed";
+  } else {
+    ok = s.propagates(r);
+    w << s[0] << ", " << s[1];
+  }
+  check(ok,w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  // the sign of x fixes y
+  const BoundType ps[4]  = { 1.0, 2.0, -5.0, 5.0};
+  const BoundType psr[4] = { 1.0, 2.0,  1.0, 1.0};
+  check_sgn(check,ps,psr);
+  const BoundType ng[4]  = {-2.0, -1.0, -5.0, 5.0};
+  const BoundType ngr[4] = {-2.0, -1.0, -1.0, -1.0};
+  check_sgn(check,ng,ngr);
+  // only the range of sgn is known when x straddles zero
+  const BoundType st[4]  = {-2.0, 2.0, -5.0, 5.0};
+  const BoundType str[4] = {-2.0, 2.0, -1.0, 1.0};
+  check_sgn(check,st,str);
+  // the sign of y bounds x
+  const BoundType py[4]  = {-2.0, 2.0, 0.5, 5.0};
+  const BoundType pyr[4] = { 0.0, 2.0, 0.5, 1.0};
+  check_sgn(check,py,pyr);
+  // y lies outside the range of sgn
+  const BoundType out[4] = {-2.0, 2.0, 2.0, 5.0};
+  check_sgn(check,out,NULL);
+
+  return check.status();
+}
@@ -0,0 +1,116 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+#include <cmath>
+
+/**
+ * \brief The model of tests/sinxcosx.cpp, \f$ \sin x = \cos x \f$
+ *
+ * With \a fused the sine and the cosine are posted by sincos(),
+ * otherwise by sin() and cos() as in tests/sinxcosx.cpp.
+ */
+class SinxCosx : public Gecode::Space {
+protected:
+  CPFloatVar x;
+  CPFloatVar y;
+  CPFloatVar z;
+public:
+  SinxCosx(bool fused)  {
+    x = CPFloatVar(*this,0.0,3.1415);
+    y = CPFloatVar(*this,-1.0,1.0);
+    z = CPFloatVar(*this,-1.0,1.0);
+
+    if (fused) {
+      sincos(*this,x,y,z);
+    } else {
+      sin(*this,x,y);
+      cos(*this,x,z);
+    }
+    equality(*this,y,z);
+    branch(*this,x);
+  }
+  Box box(void) const {
+    Box b;
+    b.push_back(std::make_pair(x.glb(),x.lub()));
+    b.push_back(std::make_pair(y.glb(),y.lub()));
+    b.push_back(std::make_pair(z.glb(),z.lub()));
+    return b;
+  }
+  SinxCosx(bool share, SinxCosx& s)
+    : Gecode::Space(share,s) {
+    x.update(*this, share, s.x);
+    y.update(*this,share,s.y);
+    z.update(*this,share,s.z);
+  }
+  virtual Space* copy(bool share) {
+    return new SinxCosx(share,*this);
+  }
+};
+
+/// Checks that sincos() narrows \a d at least as much as sin() and cos()
+void check_sincos(Check& check, const BoundType d[6]) {
+  Vars f(3,d), s(3,d);
+  sincos(f,f[0],f[1],f[2]);
+  sin(s,s[0],s[1]);
+  cos(s,s[0],s[2]);
+  std::ostringstream w;
+  w << "sincos, x in [" << d[0] << "," << d[1] << "]: ";
+  bool ok = (f.status() != SS_FAILED) && (s.status() != SS_FAILED);
+  if (ok) {
+    w << f[0] << ", " << f[1] << ", " << f[2];
+    for (int i=0; i<3; i++)
+      ok = ok && (f[i].glb() >= s[i].glb()) && (f[i].lub() <= s[i].lub());
+  } else {
+    w << "failed";
+  }
+  check(ok,w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  const BoundType a[6] = {0.5, 1.0, -1.0, 1.0, -1.0, 1.0};
+  check_sincos(check,a);
+  const BoundType b[6] = {2.0, 4.0, -1.0, 1.0, -1.0, 1.0};
+  check_sincos(check,b);
+  // sin(x) >= 0.9 narrows x, then s^2 + c^2 = 1 narrows c
+  const BoundType c[6] = {-3.0, 3.0, 0.9, 1.0, -1.0, 1.0};
+  check_sincos(check,c);
+
+  unsigned long int n, m;
+  std::vector<Box> s = solutions(new SinxCosx(false),n);
+  std::vector<Box> f = solutions(new SinxCosx(true),m);
+  // x = pi/4 and y = z = sqrt(2)/2
+  std::vector<Box> r(1,Box(3));
+  r[0][0] = std::make_pair(std::atan(1.0),std::atan(1.0));
+  r[0][1] = r[0][2] = std::make_pair(std::sqrt(0.5),std::sqrt(0.5));
+  std::ostringstream w;
+  w << "sin(x) = cos(x): " << s.size() << " solutions, " << n
+    << " nodes with sin and cos, " << f.size() << " solutions, " << m
+    << " nodes with sincos";
+  check(!s.empty() && !f.empty() && covered(s,r,1e-6) && covered(f,r,1e-6) &&
+        covered(s,f,1e-6) && covered(f,s,1e-6),w.str());
+
+  return check.status();
+}
@@ -0,0 +1,97 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/**
+ * \brief The equations of tests/caprasse-hc4.cpp with \f$ z = t = 0.5 \f$
+ *
+ * Fixing z and t leaves four isolated solutions. With \a k < 2 the
+ * model branches with firstfail() as tests/caprasse-hc4.cpp does,
+ * otherwise with smear() into \a k slices.
+ */
+class Caprasse : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+public:
+  Caprasse(CPFloatVarBranch vars, int k)
+    : a_(*this, 4, -10.0, 10.0) {
+    VarExpression x(a_[0]), y(a_[1]), z(a_[2]), t(a_[3]);
+    equality(*this,a_[2],0.5);
+    equality(*this,a_[3],0.5);
+
+    Constraint& c0 = (((y^2) * z) + (x * y * t * 2.0)) - (x * 2.0) - z == 0.0;
+    Constraint& c1 = ((x * 4.0 * (y^2) * z) - ((x^2) * x * z) - ((y^2) * 10.0) - (y * t * 10.0)) + ((x^2) * y * t * 4.0) + ((y^2) * y * t * 2.0) + ((x^2) * 4.0) + (x * z * 4.0) + 2.0 == 0.0;
+
+    if (k < 2) {
+      firstfail(*this,a_);
+    } else {
+      ConstraintArgs c(2);
+      c[0] = &c0;
+      c[1] = &c1;
+      smear(*this,a_,c,vars,CPFLOAT_VAL_SPLIT_MIN,CPFLOAT_SPLIT_RATIO,k);
+    }
+
+    hc4(*this,c0);
+    hc4(*this,c1);
+  }
+  Box box(void) const {
+    return ::box(a_);
+  }
+  Caprasse(bool share, Caprasse& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Caprasse(share,*this);
+  }
+};
+
+/// Checks that smear() with \a vars and \a k slices finds the solutions \a d
+void check_smear(Check& check, const char* name, CPFloatVarBranch vars,
+                 int k, const std::vector<Box>& d) {
+  unsigned long int n;
+  std::vector<Box> s = solutions(new Caprasse(vars,k),n);
+  std::ostringstream w;
+  w << "Caprasse, " << name << ", " << k << " slices: " << s.size()
+    << " solutions, " << n << " nodes";
+  check(!s.empty() && covered(s,d,1e-6) && covered(d,s,1e-6),w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  unsigned long int n;
+  std::vector<Box> d = solutions(new Caprasse(CPFLOAT_VAR_NONE,0),n);
+  std::ostringstream w;
+  w << "Caprasse, firstfail: " << d.size() << " solutions, " << n << " nodes";
+  check(!d.empty(),w.str());
+
+  check_smear(check,"smear sum",CPFLOAT_VAR_SMEAR_SUM,2,d);
+  check_smear(check,"smear max",CPFLOAT_VAR_SMEAR_MAX,2,d);
+  check_smear(check,"relative smear",CPFLOAT_VAR_SMEAR_REL,2,d);
+  // the slices are ordered by violation
+  check_smear(check,"smear sum",CPFLOAT_VAR_SMEAR_SUM,3,d);
+  check_smear(check,"smear max",CPFLOAT_VAR_SMEAR_MAX,3,d);
+
+  return check.status();
+}
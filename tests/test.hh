@@ -0,0 +1,251 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#ifndef __CPFLOAT_TESTS_TEST_HH__
+#define __CPFLOAT_TESTS_TEST_HH__
+
+#include <gecode/search.hh>
+#include <cpfloat/cpfloat.hh>
+#include <cpfloat/expression.hh>
+#include <cpfloat/search/minimize.hh>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Gecode;
+using namespace MPG;
+using namespace MPG::CPFloat;
+
+/// Outcome of the checks of a test program
+class Check {
+protected:
+  /// Whether all checks so far passed
+  bool ok_;
+public:
+  /// Constructor
+  Check(void) : ok_(true) {}
+  /// Records the check \a b, printing \a what, returns \a b
+  bool operator ()(bool b, const std::string& what) {
+    std::cout << what << (b ? "" : " *** WRONG ***") << std::endl;
+    ok_ = ok_ && b;
+    return b;
+  }
+  /// Exit status of the test program
+  int status(void) const {
+    return ok_ ? 0 : 1;
+  }
+};
+
+/// Bounds of every variable of a solution, used to compare the searches
+typedef std::vector<std::pair<BoundType,BoundType> > Box;
+
+/// Returns the bounds of the variables \a x
+inline Box
+box(const CPFloatVarArray& x) {
+  Box b;
+  for (int i=0; i<x.size(); i++)
+    b.push_back(std::make_pair(x[i].glb(),x[i].lub()));
+  return b;
+}
+
+/// Whether every box of \a a is within \a d of some box of \a b
+inline bool
+covered(const std::vector<Box>& a, const std::vector<Box>& b, BoundType d) {
+  for (unsigned int i=0; i<a.size(); i++) {
+    bool found = false;
+    for (unsigned int j=0; !found && (j<b.size()); j++) {
+      found = true;
+      for (unsigned int k=0; k<a[i].size(); k++)
+        if ((std::fabs(a[i][k].first-b[j][k].first) > d) ||
+            (std::fabs(a[i][k].second-b[j][k].second) > d))
+          found = false;
+    }
+    if (!found)
+      return false;
+  }
+  return true;
+}
+
+/// Returns the solutions of \a s by depth-first search, and its \a nodes
+template <class Model>
+std::vector<Box> solutions(Model* s, unsigned long int& nodes) {
+  DFS<Model> e(s);
+  delete s;
+  std::vector<Box> b;
+  while (Model* t = e.next()) {
+    b.push_back(t->box());
+    delete t;
+  }
+  nodes = e.statistics().node;
+  return b;
+}
+
+/**
+ * \brief Whether \f$ [l,u] \f$ is a certified enclosure of the minimum \a m
+ *
+ * The upper bound must be finite, the enclosure must contain \a m and
+ * be no wider than twice the cut of the absolute and relative
+ * tolerances \a a and \a r: a wide enclosure means that the probes or
+ * the pruning did not work.
+ */
+inline bool
+certified(BoundType l, BoundType u, BoundType m, BoundType a, BoundType r) {
+  return (u < std::numeric_limits<BoundType>::infinity()) &&
+    (l <= m) && (m <= u) && (u - l <= 2.0 * (a + r * std::fabs(u)));
+}
+
+/// Whether \a a and \a b agree up to the outward rounding of the propagators
+inline bool
+agree(BoundType a, BoundType b) {
+  return std::fabs(a-b) <= 1e-12 * std::max(1.0,std::fabs(b));
+}
+
+/// Variables with given domains, propagated by the tests
+class Vars : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+public:
+  Vars(int n, const BoundType* d)
+    : a_(*this, n, -1.0, 1.0) {
+    for (int i=0; i<n; i++)
+      a_[i] = CPFloatVar(*this,d[2*i],d[2*i+1]);
+  }
+  CPFloatVar operator [](int i) {
+    return a_[i];
+  }
+  /// Whether the space propagates to the domains \a d
+  bool propagates(const BoundType* d) {
+    if (status() == SS_FAILED)
+      return false;
+    for (int i=0; i<a_.size(); i++)
+      if (!agree(a_[i].glb(),d[2*i]) || !agree(a_[i].lub(),d[2*i+1]))
+        return false;
+    return true;
+  }
+  Vars(bool share, Vars& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Vars(share,*this);
+  }
+};
+
+/// Isolated solutions, branching with firstfail() when \a branching is set
+class HC4Bronstein : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+public:
+  HC4Bronstein(bool branching=true)
+    : a_(*this, 3, -1000.0, 1000.0) {
+    VarExpression x(a_[0]), y(a_[1]), z(a_[2]);
+
+    hc4(*this, ((x^2) + (y^2) + (z^2)) - 36.0 == 0.0 );
+    hc4(*this, (x + y) - z == 0.0 );
+    hc4(*this, (x * y) + (z^2) - 1.0 == 0.0 );
+
+    if (branching)
+      firstfail(*this,a_);
+  }
+  Box box(void) const {
+    return ::box(a_);
+  }
+  CPFloatVarArgs variables(void) const {
+    return a_;
+  }
+  HC4Bronstein(bool share, HC4Bronstein& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new HC4Bronstein(share,*this);
+  }
+};
+
+/// Minimum -1 at (1,0)
+class Quadratic : public MinimizeSpace {
+protected:
+  CPFloatVarArray a_;
+public:
+  Quadratic(void)
+    : a_(*this, 2, -10.0, 10.0) {
+    VarExpression x(a_[0]), y(a_[1]);
+
+    objective((x^2) - (2.0*x) + (y^2));
+
+    branch(*this,a_,CPFLOAT_VAR_SIZE_MAX,CPFLOAT_VAL_SPLIT_MIN);
+  }
+  virtual CPFloatVarArgs variables(void) const {
+    return a_;
+  }
+  Quadratic(bool share, Quadratic& sp)
+    : MinimizeSpace(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Quadratic(share,*this);
+  }
+};
+
+/// Minimum 0 at (2,1) on the circle of center (1,1) and radius 1
+class Circle : public MinimizeSpace {
+protected:
+  CPFloatVarArray a_;
+public:
+  Circle(void)
+    : a_(*this, 2, -10.0, 10.0) {
+    VarExpression x(a_[0]), y(a_[1]);
+
+    hc4(*this, ((x - 1.0)^2) + ((y - 1.0)^2) == 1.0);
+    objective(((x - 2.0)^2) + ((y - 1.0)^2));
+
+    branch(*this,a_,CPFLOAT_VAR_SIZE_MAX,CPFLOAT_VAL_SPLIT_MIN);
+  }
+  virtual CPFloatVarArgs variables(void) const {
+    CPFloatVarArgs x(1);
+    x[0] = a_[0];
+    return x;
+  }
+  Circle(bool share, Circle& sp)
+    : MinimizeSpace(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Circle(share,*this);
+  }
+};
+
+/// Checks the enclosure of the minimum \a m of \a Model found by \a E with \a o
+template <class Model, template<class> class E, class O>
+bool minimum(Check& check, const std::string& name, BoundType m, const O& o) {
+  Model* s = new Model();
+  BoundType a = s->absolute(), r = s->relative();
+  Minimize<Model,E> e(s,o);
+  delete s;
+  while (Model* t = e.next())
+    delete t;
+  std::ostringstream w;
+  w << name << ": minimum in [" << e.lower() << "," << e.upper() << "], "
+    << e.statistics().node << " nodes";
+  return check(!e.stopped() && certified(e.lower(),e.upper(),m,a,r),w.str());
+}
+
+#endif
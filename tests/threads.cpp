@@ -0,0 +1,85 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+#include <algorithm>
+
+class Trigonometric : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+public:
+  Trigonometric(void)
+    : a_(*this, 3, -10.0, 10.0) {
+    sin(*this,a_[0],a_[1]);
+    cos(*this,a_[0],a_[2]);
+    equality(*this,a_[1],a_[2]);
+
+    firstfail(*this,a_);
+  }
+  Box box(void) const {
+    return ::box(a_);
+  }
+  Trigonometric(bool share, Trigonometric& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new Trigonometric(share,*this);
+  }
+};
+
+/// Returns all the solutions of \a Model found with \a threads workers
+template <class Model>
+std::vector<Box> solve(unsigned int threads) {
+  Model* m = new Model();
+  Search::Options o;
+  o.threads = threads;
+  DFS<Model> e(m,o);
+  delete m;
+  std::vector<Box> sols;
+  while (Model* s = e.next()) {
+    sols.push_back(s->box());
+    delete s;
+  }
+  std::sort(sols.begin(),sols.end());
+  return sols;
+}
+
+/// Compares the multi-threaded searches of \a Model against a sequential one
+template <class Model>
+void compare(Check& check, const char* name) {
+  std::vector<Box> seq = solve<Model>(1);
+  for (unsigned int t=2; t<=8; t*=2) {
+    std::vector<Box> par = solve<Model>(t);
+    std::ostringstream w;
+    w << name << ": " << seq.size() << " solutions sequential, "
+      << par.size() << " with " << t << " threads";
+    check(par == seq,w.str());
+  }
+}
+
+int main(int, char**) {
+  Check check;
+  compare<Trigonometric>(check,"Trigonometric");
+  compare<HC4Bronstein>(check,"Bronstein");
+  return check.status();
+}
@@ -0,0 +1,122 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/// \f$ x^2 = y \f$ with \a x a union variable
+class UnionSquare : public Gecode::Space {
+protected:
+  CPFloatUnionVar x_;
+  CPFloatVar y_;
+public:
+  UnionSquare(BoundType xl, BoundType xu, BoundType yl, BoundType yu,
+              BoundType p)
+    : x_(*this, xl, xu, VarPrecision<double>(p)),
+      y_(*this, yl, yu, VarPrecision<double>(p)) {
+    power(*this,x_,2,y_);
+    branch(*this,x_);
+  }
+  const CPFloatUnionVar& x(void) const {
+    return x_;
+  }
+  UnionSquare(bool share, UnionSquare& sp)
+    : Gecode::Space(share,sp) {
+    x_.update(*this, share, sp.x_);
+    y_.update(*this, share, sp.y_);
+  }
+  virtual Space* copy(bool share) {
+    return new UnionSquare(share,*this);
+  }
+};
+
+/// \f$ x^2 = y \f$ with \a x an interval variable, split at the median
+class Square : public Gecode::Space {
+protected:
+  CPFloatVar x_;
+  CPFloatVar y_;
+public:
+  Square(BoundType xl, BoundType xu, BoundType yl, BoundType yu,
+         BoundType p)
+    : x_(*this, xl, xu, VarPrecision<double>(p)),
+      y_(*this, yl, yu, VarPrecision<double>(p)) {
+    power(*this,x_,2,y_);
+    branch(*this,x_);
+  }
+  const CPFloatVar& x(void) const {
+    return x_;
+  }
+  Square(bool share, Square& sp)
+    : Gecode::Space(share,sp) {
+    x_.update(*this, share, sp.x_);
+    y_.update(*this, share, sp.y_);
+  }
+  virtual Space* copy(bool share) {
+    return new Square(share,*this);
+  }
+};
+
+/**
+ * \brief Paves the roots of \a Model, returns the number of nodes
+ *
+ * Sets \a neg and \a pos when boxes of the negative and positive roots
+ * were found.
+ */
+template <class Model>
+unsigned long int pave(Model* m, bool& neg, bool& pos) {
+  DFS<Model> e(m);
+  delete m;
+  neg = pos = false;
+  while (Model* s = e.next()) {
+    neg = neg || (s->x().lub() < 0.0);
+    pos = pos || (s->x().glb() > 0.0);
+    delete s;
+  }
+  return e.statistics().node;
+}
+
+int main(int, char**) {
+  Check check;
+
+  // propagation cuts the hole around zero
+  UnionSquare* s = new UnionSquare(-3.0,3.0,1.0,4.0,1e-9);
+  bool cut = (s->status() != SS_FAILED) && (s->x().pieces() == 2) &&
+    agree(s->x().lo(0),-2.0) && agree(s->x().hi(0),-1.0) &&
+    agree(s->x().lo(1),1.0) && agree(s->x().hi(1),2.0);
+  std::ostringstream w;
+  w << "x^2 = y, y in [1,4]: x = " << s->x();
+  check(cut,w.str());
+  delete s;
+
+  // the median of the hull falls into the positive root, so bisection
+  // needs an extra node for the box straddling the hole
+  bool un, up, in, ip;
+  unsigned long int gap =
+    pave(new UnionSquare(-1.5,4.0,1.0,16.0,1.0),un,up);
+  unsigned long int median =
+    pave(new Square(-1.5,4.0,1.0,16.0,1.0),in,ip);
+  w.str("");
+  w << "x^2 = y, y in [1,16]: both roots in " << gap
+    << " nodes with gaps, " << median << " with the median";
+  check(un && up && in && ip && (gap < median),w.str());
+
+  return check.status();
+}
@@ -0,0 +1,89 @@
+/*
+ *  Authors:
+ *     Gonzalo Hernández <gonzalohernandez@udenar.edu.co>
+ *     Gustavo Gutierrez
+ *
+ *  Year of last major update
+ *     2011
+ * 
+ *  This file is a complement of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test.hh"
+
+/**
+ * \brief The equations of HC4Bronstein, branching with wdeg()
+ *
+ * As tests/bronstein-hc4.cpp, which branches with firstfail().
+ */
+class WDegBronstein : public Gecode::Space {
+protected:
+  CPFloatVarArray a_;
+public:
+  WDegBronstein(CPFloatVarBranch vars, double decay)
+    : a_(*this, 3, -1000.0, 1000.0) {
+    VarExpression x(a_[0]), y(a_[1]), z(a_[2]);
+
+    Constraint& c0 = ((x^2) + (y^2) + (z^2)) - 36.0 == 0.0;
+    Constraint& c1 = (x + y) - z == 0.0;
+    Constraint& c2 = (x * y) + (z^2) - 1.0 == 0.0;
+
+    ConstraintArgs c(3);
+    c[0] = &c0;
+    c[1] = &c1;
+    c[2] = &c2;
+    wdeg(*this,a_,c,vars,CPFLOAT_VAL_SPLIT_MAX,decay);
+
+    hc4(*this,c0);
+    hc4(*this,c1);
+    hc4(*this,c2);
+  }
+  Box box(void) const {
+    return ::box(a_);
+  }
+  WDegBronstein(bool share, WDegBronstein& sp)
+    : Gecode::Space(share,sp) {
+    a_.update(*this, share, sp.a_);
+  }
+  virtual Space* copy(bool share) {
+    return new WDegBronstein(share,*this);
+  }
+};
+
+/// Checks that wdeg() with \a vars and \a decay finds the solutions \a d
+void check_wdeg(Check& check, const char* name, CPFloatVarBranch vars,
+                double decay, const std::vector<Box>& d) {
+  unsigned long int n;
+  std::vector<Box> s = solutions(new WDegBronstein(vars,decay),n);
+  std::ostringstream w;
+  w << "Bronstein, " << name << ", decay " << decay << ": " << s.size()
+    << " solutions, " << n << " nodes";
+  check(!s.empty() && covered(s,d,1e-6) && covered(d,s,1e-6),w.str());
+}
+
+int main(int, char**) {
+  Check check;
+
+  unsigned long int n;
+  std::vector<Box> d = solutions(new HC4Bronstein(),n);
+  std::ostringstream w;
+  w << "Bronstein, firstfail: " << d.size() << " solutions, " << n << " nodes";
+  check(!d.empty(),w.str());
+
+  check_wdeg(check,"weight",CPFLOAT_VAR_WDEG_MAX,1.0,d);
+  check_wdeg(check,"width times weight",CPFLOAT_VAR_SIZE_WDEG_MAX,1.0,d);
+  check_wdeg(check,"width times weight",CPFLOAT_VAR_SIZE_WDEG_MAX,0.95,d);
+
+  return check.status();
+}